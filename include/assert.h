@@ -62,7 +62,7 @@ namespace hyenae
                 string_t message = "");
 
             static void argument_not_null(
-                void* pointer,
+                const void* pointer,
                 string_t param_name = "",
                 string_t message = "");
 
@@ -0,0 +1,51 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include "../common.h"
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    class allocation_counter
+    {
+        private:
+            static atomic_t<uint64_t> _count;
+
+        public:
+            static uint64_t get_count();
+            static void increment();
+
+    }; /* allocation_counter */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
+
+#endif /* ALLOCATION_COUNTER_H */
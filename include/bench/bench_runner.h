@@ -0,0 +1,95 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BENCH_RUNNER_H
+#define BENCH_RUNNER_H
+
+#include "../common.h"
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    class bench_runner
+    {
+        public:
+            using op_t = func_t<void()>;
+
+            struct metric
+            {
+                string_t name;
+                double value;
+
+            }; /* metric */
+
+            struct result
+            {
+                string_t name;
+                size_t iterations;
+                duration_t duration;
+                uint64_t allocations;
+                size_t bytes_per_op;
+                bool packets;
+                vector_t<metric> metrics;
+
+            }; /* result */
+
+        private:
+            static const size_t MIN_ITERATIONS = 1;
+            static const size_t MAX_ITERATIONS = 1000000000;
+
+            string_t _filter;
+            duration_t _min_time;
+            vector_t<result> _results;
+
+        public:
+            bench_runner(const string_t& filter, duration_t min_time);
+            bool is_selected(const string_t& name) const;
+            duration_t get_min_time() const;
+
+            void run(
+                const string_t& name,
+                size_t bytes_per_op,
+                bool packets,
+                op_t op);
+
+            void add(const result& result);
+            size_t result_count() const;
+            const result& result_at(size_t pos) const;
+            string_t to_json(const string_t& label) const;
+
+        private:
+            static string_t to_json(const result& result);
+            static string_t to_json_string(const string_t& value);
+            static string_t to_fixed_string(double value);
+
+    }; /* bench_runner */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
+
+#endif /* BENCH_RUNNER_H */
@@ -29,6 +29,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <string>
@@ -37,6 +39,8 @@
 #include <cstdarg>
 #include <stdexcept>
 #include <functional>
+#include <condition_variable>
+#include <unordered_map>
 
 namespace hyenae
 {
@@ -51,6 +55,8 @@ namespace hyenae
     static const size_t SIZE_UINT32 = 4;
     static const size_t SIZE_UINT64 = 8;
 
+    static const size_t CACHE_LINE_SIZE = 64;
+
     static const size_t FORMAT_BUFFER_SIZE = 1024;
 
     /*---------------------------------------------------------------------- */
@@ -59,6 +65,8 @@ namespace hyenae
 
     using byte_t = std::byte;
     using thread_t = std::thread;
+    using mutex_t = std::mutex;
+    using condition_t = std::condition_variable;
     using string_t = std::string;
     using duration_t = std::chrono::system_clock::duration;
 
@@ -68,6 +76,9 @@ namespace hyenae
     template<typename T>
     using vector_t = std::vector<T>;
 
+    template<typename T>
+    using atomic_t = std::atomic<T>;
+
     template<typename K, typename V>
     using unordered_map_t = std::unordered_map<K, V>;
 
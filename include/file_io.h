@@ -41,7 +41,11 @@ namespace hyenae
             virtual ~file_io() {}
 			virtual bool is_open() const = 0;
             virtual bool exists(const string_t& filename) const = 0;
-			virtual void open(const string_t& filename, bool overwrite) = 0;
+			virtual void open(
+				const string_t& filename,
+				bool overwrite,
+				bool binary = false) = 0;
+
 			virtual void close() noexcept  = 0;
 			virtual void write(const string_t& content) = 0;
 			virtual void write(byte_t* data, size_t size) = 0;
@@ -27,9 +27,12 @@
 #ifndef DISPATCHER_SETUP_H
 #define DISPATCHER_SETUP_H
 
+#include "../../../../include/config.h"
 #include "../../../../include/model/data_dispatcher.h"
 #include "../../../../include/model/fixed_duration_generator.h"
 #include "../../../../include/model/random_duration_generator.h"
+#include "../../../../include/model/token_bucket.h"
+#include "../../../../include/frontend/headless/scenario.h"
 #include "../../../../include/frontend/console/console_menu.h"
 #include "../../../../include/frontend/console/console_app_state.h"
 #include "../../../../include/frontend/console/states/startable_state.h"
@@ -44,17 +47,29 @@ namespace hyenae::frontend::console::states
         public startable_state,
         public console_app_state
     {
+        using data_dispatcher_t = hyenae::model::data_dispatcher;
         using limits_t = hyenae::model::data_dispatcher::limits;
         using delay_t = hyenae::model::duration_generator;
         using fixed_delay_t = hyenae::model::fixed_duration_generator;
         using random_delay_t = hyenae::model::random_duration_generator;
+        using pacer_t = hyenae::model::token_bucket;
+        using wait_policy_t = hyenae::model::data_dispatcher::wait_policy;
+        using section_t = config::section;
+        using scenario_t = hyenae::frontend::headless::scenario;
 
         private:
+            static const int64_t MAX_WORKER_COUNT = 64;
+            static const int64_t MAX_BATCH_SIZE = 1024;
+            static const int64_t MAX_RING_DEPTH = 65536;
+            static const int64_t MAX_CACHE_SIZE = 1048576;
+            static const int64_t MAX_STATS_INTERVAL = 60000;
+
             enum class delay_type
             {
                 NONE = 0,
                 FIXED = 1,
-                RANDOM = 2
+                RANDOM = 2,
+                RATE = 3
 
             }; /* delay_type */
 
@@ -63,9 +78,22 @@ namespace hyenae::frontend::console::states
             console_menu::item* _packet_limit_item = NULL;
             console_menu::item* _duration_limit_item = NULL;
             console_menu::item* _send_delay_item = NULL;
+            console_menu::item* _worker_count_item = NULL;
+            console_menu::item* _batch_size_item = NULL;
+            console_menu::item* _wait_policy_item = NULL;
+            console_menu::item* _ring_depth_item = NULL;
+            console_menu::item* _cache_size_item = NULL;
+            console_menu::item* _stats_interval_item = NULL;
             limits_t* _limits;
             delay_t* _delay;
+            pacer_t* _pacer;
             delay_type _delay_type;
+            size_t _worker_count;
+            size_t _batch_size;
+            wait_policy_t _wait_policy;
+            size_t _ring_depth;
+            size_t _cache_size;
+            duration_t _stats_interval;
 
         public:
             dispatcher_setup(
@@ -78,15 +106,32 @@ namespace hyenae::frontend::console::states
             bool run();
             limits_t* get_limits();
             delay_t* get_delay();
+            pacer_t* get_pacer();
+            size_t get_worker_count() const;
+            size_t get_batch_size() const;
+            wait_policy_t get_wait_policy() const;
+            size_t get_ring_depth() const;
+            size_t get_cache_size() const;
+            duration_t get_stats_interval() const;
+            void save_scenario(section_t* section) const;
+            void load_scenario(section_t* section);
 
         private:
             void update_menu_items();
+            void load_delay(section_t* section);
             void prompt_byte_limit();
             void prompt_packet_limit();
             void prompt_duration_limit();
             void prompt_send_delay();
             void prompt_fixed_send_delay();
             void prompt_random_send_delay();
+            void prompt_rate_send_delay();
+            void prompt_worker_count();
+            void prompt_batch_size();
+            void prompt_wait_policy();
+            void prompt_ring_depth();
+            void prompt_cache_size();
+            void prompt_stats_interval();
 
     }; /* main_menu */
 
@@ -131,6 +131,9 @@ namespace hyenae::frontend::console::states
             string_t get_generator_name() const;
             data_generator_t* get_generator() const;
             void update_generator();
+            string_t get_scenario_type() const;
+            void save_scenario(section_t* section) const;
+            void load_scenario(section_t* section);
 
         protected:
             void on_select() {};
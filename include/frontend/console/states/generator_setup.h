@@ -27,7 +27,9 @@
 #ifndef GENERATOR_SETUP_H
 #define GENERATOR_SETUP_H
 
+#include "../../../../include/config.h"
 #include "../../../../include/model/data_generator.h"
+#include "../../../../include/frontend/headless/scenario.h"
 #include "../../../../include/frontend/console/console_app_state.h"
 #include "../../../../include/frontend/console/states/startable_state.h"
 
@@ -43,6 +45,8 @@ namespace hyenae::frontend::console::states
 
         public:
             using data_generator_t = hyenae::model::data_generator;
+            using section_t = config::section;
+            using scenario_t = hyenae::frontend::headless::scenario;
 
         public:
             generator_setup(
@@ -54,6 +58,9 @@ namespace hyenae::frontend::console::states
             virtual string_t get_generator_name() const = 0;
             virtual data_generator_t* get_generator() const = 0;
             virtual void update_generator() = 0;
+            virtual string_t get_scenario_type() const = 0;
+            virtual void save_scenario(section_t* section) const = 0;
+            virtual void load_scenario(section_t* section) = 0;
 
         protected:
             virtual void on_select() = 0;
@@ -71,6 +71,9 @@ namespace hyenae::frontend::console::states
             uint8_t get_code() const;
             void set_code(uint8_t code);
             void update_generator();
+            string_t get_scenario_type() const;
+            void save_scenario(section_t* section) const;
+            void load_scenario(section_t* section);
 
         protected:
             void on_select();
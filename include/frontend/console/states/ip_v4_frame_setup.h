@@ -92,6 +92,9 @@ namespace hyenae::frontend::console::states
             data_generator_t* get_generator() const;
             data_generator_t* get_pseudo_header() const;
             void update_generator();
+            string_t get_scenario_type() const;
+            void save_scenario(section_t* section) const;
+            void load_scenario(section_t* section);
 
         protected:
             void on_select();
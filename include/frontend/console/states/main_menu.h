@@ -27,7 +27,9 @@
 #ifndef MAIN_MENU_H
 #define MAIN_MENU_H
 
+#include "../../../../include/config.h"
 #include "../../../../include/file_io.h"
+#include "../../../../include/frontend/headless/scenario.h"
 #include "../../../../include/frontend/console/console_menu.h"
 #include "../../../../include/frontend/console/console_app_state.h"
 #include "../../../../include/frontend/console/console_app_config.h"
@@ -45,16 +47,23 @@ namespace hyenae::frontend::console::states
     {
         using limits_t = model::data_dispatcher::limits;
         using delay_t = model::duration_generator;
+        using scenario_t = hyenae::frontend::headless::scenario;
 
         private:
+            static const char* SCENARIO_PATH;
+
+            file_io::provider _file_io_provider;
             console_menu* _menu = NULL;
             console_menu::item* _output_setup_item = NULL;
             console_menu::item* _generator_selector_item = NULL;
             console_menu::item* _dispatcher_setup_item = NULL;
+            console_menu::item* _save_scenario_item = NULL;
+            console_menu::item* _load_scenario_item = NULL;
             states::output_setup* _output_setup = NULL;
             states::generator_selector* _generator_selector = NULL;
             states::dispatcher_setup* _dispatcher_setup = NULL;
             states::start_dispatcher* _start_dispatcher = NULL;
+            string_t _scenario_path;
 
         public:
             main_menu(
@@ -66,6 +75,10 @@ namespace hyenae::frontend::console::states
             ~main_menu();
             bool run();
 
+        private:
+            void save_scenario();
+            void load_scenario();
+
     }; /* main_menu */
 
     /*---------------------------------------------------------------------- */
@@ -61,6 +61,7 @@ namespace hyenae::frontend::console::states
             ~network_device_selector();
             bool run();
             device_t* get_device() const;
+            void select_device(const string_t& name);
 
         private:
             console_menu::item* add_device(device_t* device);
@@ -27,9 +27,12 @@
 #ifndef OUTPUT_SETUP_H
 #define OUTPUT_SETUP_H
 
+#include "../../../../include/config.h"
 #include "../../../../include/file_io.h"
 #include "../../../../include/model/data_output.h"
 #include "../../../../include/model/outputs/network_output.h"
+#include "../../../../include/model/outputs/capture_file_output.h"
+#include "../../../../include/frontend/headless/scenario.h"
 #include "../../../../include/frontend/console/console_menu.h"
 #include "../../../../include/frontend/console/console_app_state.h"
 #include "../../../../include/frontend/console/states/startable_state.h"
@@ -50,20 +53,32 @@ namespace hyenae::frontend::console::states
 
         using data_output_t = hyenae::model::data_output;
 
+        using capture_format_t =
+            hyenae::model::outputs::capture_file_output::format;
+
         using device_t = hyenae::model::outputs::network_output::device;
+        using section_t = config::section;
+        using scenario_t = hyenae::frontend::headless::scenario;
 
         private:
             static const char* FILE_OUTPUT_PATH;
+            static const char* CAPTURE_FILE_OUTPUT_PATH;
 
             file_io::provider _file_io_provider;
             network_device_selector* _network_device_selector = NULL;
             console_menu* _menu = NULL;
             unordered_map_t<console_menu::item*, data_output_t*> _menu_items;
+            console_menu::item* _no_output_item = NULL;
             console_menu::item* _file_output_item = NULL;
+            console_menu::item* _capture_file_output_item = NULL;
             console_menu::item* _network_output_item = NULL;
+            console_menu::item* _packet_mmap_output_item = NULL;
             console_menu::item* _selected_item = NULL;
             data_output_t* _output = NULL;
             string_t _file_path;
+            string_t _capture_file_path;
+            capture_format_t _capture_file_format;
+            bool _capture_file_nanoseconds;
             string_t _network_error;
 
         public:
@@ -77,15 +92,19 @@ namespace hyenae::frontend::console::states
             ~output_setup();
             bool run();
             data_output_t* get_output() const;
+            void save_scenario(section_t* section) const;
+            void load_scenario(section_t* section);
 
         private:
             void update_menu_items();
             void update_network_output();
+            void select_item(console_menu::item* item);
 
             console_menu::item* add_output(
                 string_t caption, data_output_t* output);
 
             data_output_t* select_file_output(bool setup);
+            data_output_t* select_capture_file_output(bool setup);
 
     }; /* main_menu */
 
@@ -53,6 +53,9 @@ namespace hyenae::frontend::console::states
         private:
             const int64_t WARMUP_TIMEOUT = 3000;
 
+            const duration_t KEY_POLL_INTERVAL =
+                std::chrono::milliseconds{ 50 };
+
             output_setup* _output_setup;
             generator_setup* _generator_setup;
             dispatcher_setup* _dispatcher_setup;
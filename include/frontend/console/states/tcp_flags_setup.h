@@ -27,6 +27,8 @@
 #ifndef TCP_FLAGS_SETUP_H
 #define TCP_FLAGS_SETUP_H
 
+#include "../../../../include/config.h"
+#include "../../../../include/frontend/headless/scenario.h"
 #include "../../../../include/frontend/console/console_menu.h"
 #include "../../../../include/frontend/console/console_app_state.h"
 #include "../../../../include/frontend/console/states/startable_state.h"
@@ -42,6 +44,9 @@ namespace hyenae::frontend::console::states
         public startable_state,
         public console_app_state
     {
+        using section_t = config::section;
+        using scenario_t = hyenae::frontend::headless::scenario;
+
         private:
             console_menu* _menu = NULL;
             console_menu::item* _cwr_flag_item = NULL;
@@ -79,6 +84,8 @@ namespace hyenae::frontend::console::states
             bool get_syn_flag() const;
             bool get_fin_flag() const;
             string_t get_flags_info() const;
+            void save_scenario(section_t* section) const;
+            void load_scenario(section_t* section);
 
         private:
             void update_menu_items();
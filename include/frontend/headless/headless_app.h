@@ -0,0 +1,87 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HEADLESS_APP_H
+#define HEADLESS_APP_H
+
+#include "../../../include/config.h"
+#include "../../../include/file_io.h"
+#include "../../../include/model/data_dispatcher.h"
+#include "../../../include/frontend/headless/scenario.h"
+
+namespace hyenae::frontend::headless
+{
+    /*---------------------------------------------------------------------- */
+
+    class headless_app :
+        public model::dispatcher_listener
+    {
+        using data_dispatcher_t = hyenae::model::data_dispatcher;
+
+        public:
+            static const string_t ARG_SCENARIO;
+            static const string_t ARG_SCENARIO_SHORT;
+            static const string_t ARG_SET;
+
+        private:
+            static const duration_t INTERRUPT_POLL_INTERVAL;
+
+            static atomic_t<bool> _interrupted;
+
+            file_io::provider _file_io_provider;
+            config* _scenario_config = NULL;
+            string_t _thread_error;
+
+        public:
+            headless_app(file_io::provider file_io_provider);
+            ~headless_app();
+            static bool is_requested(int argc, char** argv);
+            int run(int argc, char** argv);
+
+        protected:
+            void on_state_changed() {};
+            void on_stats_changed() {};
+            void on_limit_reached() {};
+            void on_thread_exception(const exception_t& exception);
+
+        private:
+            void parse_args(int argc, char** argv);
+            void load_scenario(const string_t& filename);
+            void set_value(const string_t& assignment);
+            bool dispatch(data_dispatcher_t* dispatcher);
+            void results_out(const data_dispatcher_t* dispatcher);
+            static void on_interrupt(int signal);
+
+            static void result_out(
+                const string_t& name, const string_t& value);
+
+    }; /* headless_app */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::frontend::headless */
+
+#endif /* HEADLESS_APP_H */
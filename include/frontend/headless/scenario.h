@@ -0,0 +1,171 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include "../../../include/config.h"
+#include "../../../include/file_io.h"
+#include "../../../include/model/data_dispatcher.h"
+#include "../../../include/model/generator_group.h"
+#include "../../../include/model/outputs/network_output.h"
+
+namespace hyenae::frontend::headless
+{
+    /*---------------------------------------------------------------------- */
+
+    class scenario
+    {
+        using section_t = config::section;
+        using data_output_t = hyenae::model::data_output;
+        using data_generator_t = hyenae::model::data_generator;
+        using generator_group_t = hyenae::model::generator_group;
+        using data_dispatcher_t = hyenae::model::data_dispatcher;
+        using limits_t = hyenae::model::data_dispatcher::limits;
+        using delay_t = hyenae::model::duration_generator;
+        using pacer_t = hyenae::model::token_bucket;
+        using wait_policy_t = hyenae::model::data_dispatcher::wait_policy;
+        using device_t = hyenae::model::outputs::network_output::device;
+
+        public:
+            /* Sections */
+            static const string_t SECTION_ROOT;
+            static const string_t SECTION_OUTPUT;
+            static const string_t SECTION_GENERATOR;
+            static const string_t SECTION_PAYLOAD;
+            static const string_t SECTION_DISPATCHER;
+
+        private:
+            /* Generator Flags */
+            static const size_t GFLAG_ETHERNET_FRAME = 0x1 << 0;
+            static const size_t GFLAG_ARP_FRAME = 0x1 << 1;
+            static const size_t GFLAG_IP_V4_FRAME = 0x1 << 2;
+            static const size_t GFLAG_IP_V6_FRAME = 0x1 << 3;
+            static const size_t GFLAG_ICMP_V4_FRAME = 0x1 << 4;
+            static const size_t GFLAG_ICMP_V6_FRAME = 0x1 << 5;
+            static const size_t GFLAG_ICMP_ECHO_PAYLOAD = 0x1 << 6;
+            static const size_t GFLAG_TCP_FRAME = 0x1 << 7;
+            static const size_t GFLAG_UDP_FRAME = 0x1 << 8;
+            static const size_t GFLAG_TEXT_BUFFER = 0x1 << 9;
+
+            static const int64_t MAX_WORKER_COUNT = 64;
+            static const int64_t MAX_BATCH_SIZE = 1024;
+            static const int64_t MAX_RING_DEPTH = 65536;
+            static const int64_t MAX_CACHE_SIZE = 1048576;
+            static const int64_t MAX_STATS_INTERVAL = 60000;
+
+            file_io::provider _file_io_provider;
+            device_t* _device = NULL;
+            data_output_t* _output = NULL;
+            data_generator_t* _generator = NULL;
+            delay_t* _delay = NULL;
+            pacer_t* _pacer = NULL;
+            limits_t* _limits = NULL;
+            size_t _worker_count = 1;
+            size_t _batch_size = 1;
+            wait_policy_t _wait_policy = wait_policy_t::HYBRID;
+            size_t _ring_depth = data_dispatcher_t::RING_DISABLED;
+            size_t _cache_size = data_dispatcher_t::CACHE_DISABLED;
+
+            duration_t _stats_interval =
+                data_dispatcher_t::DEFAULT_STATS_INTERVAL;
+
+        public:
+            scenario(
+                section_t* section, file_io::provider file_io_provider);
+
+            ~scenario();
+            data_dispatcher_t* create_dispatcher();
+
+            static void validate(
+                section_t* section, file_io::provider file_io_provider);
+
+            static config* load(
+                file_io::provider file_io_provider,
+                const string_t& filename);
+
+            static void save(
+                file_io::provider file_io_provider,
+                const string_t& filename,
+                config* scenario);
+
+            static section_t* find_sub_section(
+                section_t* section, const string_t& name);
+
+            static string_t get_string(
+                section_t* section,
+                const string_t& name,
+                const string_t& default_value = "");
+
+            static uint64_t get_number(
+                section_t* section,
+                const string_t& name,
+                uint64_t default_value,
+                uint64_t max_value = UINT64_MAX);
+
+            static bool get_switch(
+                section_t* section,
+                const string_t& name,
+                bool default_value = false);
+
+            static void set_string(
+                section_t* section,
+                const string_t& name,
+                const string_t& value);
+
+            static void set_number(
+                section_t* section, const string_t& name, uint64_t value);
+
+            static void set_switch(
+                section_t* section, const string_t& name, bool value);
+
+        private:
+            scenario(file_io::provider file_io_provider);
+
+            void clear();
+            void parse_output(section_t* section);
+            void parse_dispatcher(section_t* section);
+            void parse_delay(section_t* section);
+
+            data_generator_t* parse_generator(
+                section_t* section,
+                size_t generator_flags,
+                data_generator_t* pseudo_header = NULL);
+
+            static size_t to_generator_flag(const string_t& type);
+
+            static uint64_t to_protocol(
+                const string_t& type, const string_t& payload_type);
+
+            static device_t* find_device(const string_t& name);
+
+    }; /* scenario */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::frontend::headless */
+
+#endif /* SCENARIO_H */
@@ -47,7 +47,12 @@ namespace hyenae::io
 		public:
 			bool is_open() const;
             bool exists(const string_t& filename) const;
-			void open(const string_t& filename, bool overwrite);
+
+			void open(
+				const string_t& filename,
+				bool overwrite,
+				bool binary = false);
+
 			void close() noexcept;
 			void write(const string_t& content);
 			void write(byte_t* data, size_t size);
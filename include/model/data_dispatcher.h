@@ -30,6 +30,8 @@
 #include "../observable.h"
 #include "data_output.h"
 #include "data_generator.h"
+#include "packet_ring.h"
+#include "token_bucket.h"
 #include "duration_generator.h"
 #include "dispatcher_listener.h"
 
@@ -37,6 +39,8 @@ namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
 
+    class packet_template;
+
     class data_dispatcher :
         public observable<dispatcher_listener>
     {
@@ -49,20 +53,68 @@ namespace hyenae::model
 
             }; /* state */
 
+            enum class wait_policy
+            {
+                BUSY_POLL,
+                HYBRID,
+                SLEEP
+
+            }; /* wait_policy */
+
             class stats
             {
                 friend class data_dispatcher;
 
+                public:
+                    struct snapshot
+                    {
+                        size_t byte_count;
+                        size_t packet_count;
+                        duration_t duration;
+                        size_t ring_full_count;
+                        size_t ring_empty_count;
+                        size_t cached_packet_count;
+                        size_t send_failure_count;
+
+                    }; /* snapshot */
+
                 private:
-                    size_t _byte_count;
-                    size_t _packet_count;
-                    duration_t _duration;
+                    // Each worker only writes to counters of its own,
+                    // which never share a cache line with another's.
+
+                    struct alignas(CACHE_LINE_SIZE) counters
+                    {
+                        atomic_t<size_t> byte_count = 0;
+                        atomic_t<size_t> packet_count = 0;
+                        atomic_t<size_t> ring_full_count = 0;
+                        atomic_t<size_t> ring_empty_count = 0;
+                        atomic_t<size_t> cached_packet_count = 0;
+                        atomic_t<size_t> send_failure_count = 0;
+
+                    }; /* counters */
+
+                    vector_t<counters*> _counters;
+                    alignas(CACHE_LINE_SIZE) atomic_t<duration_t> _duration;
+
                     stats();
+                    ~stats();
+                    void init(size_t worker_count);
+                    counters* counters_at(size_t index);
+                    static void add(atomic_t<size_t>& counter, size_t value);
+
+                    static void subtract(
+                        atomic_t<size_t>& counter, size_t value);
+
 
                 public:
+                    snapshot get_snapshot() const;
                     size_t get_byte_count() const;
                     size_t get_packet_count() const;
                     duration_t get_duration() const;
+                    size_t get_ring_full_count() const;
+                    size_t get_ring_empty_count() const;
+                    size_t get_cached_packet_count() const;
+                    size_t get_send_failure_count() const;
                     void reset();
 
             }; /* stats */
@@ -93,25 +145,58 @@ namespace hyenae::model
                     
             }; /* limits */
 
+            static const size_t RING_DISABLED = 0;
+            static const size_t CACHE_DISABLED = 0;
+            static const duration_t DEFAULT_STATS_INTERVAL;
+
         private:
             const long long START_TIMEOUT = 3000;
 
-            data_output* _output;
-            data_generator* _generator;
+            static const duration_t SPIN_DURATION;
+            static const duration_t PAUSE_TIMEOUT;
+
+            vector_t<data_output*> _outputs;
+            vector_t<data_generator*> _generators;
             duration_generator* _delay;
+            token_bucket* _pacer;
+            wait_policy _wait_policy;
             limits* _limits;
-            volatile state _state = state::STOPPED;
+            size_t _batch_size;
+            size_t _ring_depth;
+            size_t _cache_size;
+            duration_t _stats_interval;
+            atomic_t<size_t> _claimed_bytes = 0;
+            atomic_t<size_t> _claimed_packets = 0;
+            atomic_t<state> _state = state::STOPPED;
+            atomic_t<bool> _limit_reached = false;
             stats _stats;
-            thread_t* _thread = NULL;
+            vector_t<thread_t*> _threads;
+            mutex_t _delay_mutex;
+            mutex_t _state_mutex;
+            condition_t _state_condition;
+            mutex_t _listener_mutex;
 
         public:
             data_dispatcher(
                 data_output* output,
                 data_generator* generator,
                 duration_generator* delay = NULL,
-                limits* limits = NULL);
+                limits* limits = NULL,
+                size_t worker_count = 1,
+                size_t batch_size = 1,
+                token_bucket* pacer = NULL,
+                wait_policy policy = wait_policy::HYBRID,
+                size_t ring_depth = RING_DISABLED,
+                size_t cache_size = CACHE_DISABLED,
+                duration_t stats_interval = DEFAULT_STATS_INTERVAL);
 
             ~data_dispatcher();
+            size_t get_worker_count() const;
+            size_t get_batch_size() const;
+            wait_policy get_wait_policy() const;
+            size_t get_ring_depth() const;
+            size_t get_cache_size() const;
+            duration_t get_stats_interval() const;
             state get_state() const;
             const stats* get_stats() const;
             bool is_stopped() const;
@@ -121,12 +206,61 @@ namespace hyenae::model
             void pause();
             void resume();
             void stop();
+            bool wait_for_stop(duration_t timeout);
 
         private:
             void set_state(state state);
             void state_changed();
-            static void thread_proc(void* param);
-            void dispatcher_loop();
+            void wake_workers();
+            void join_threads();
+            static void thread_proc(data_dispatcher* dispatcher, size_t index);
+            void dispatcher_loop(size_t index);
+            static void reporter_proc(data_dispatcher* dispatcher);
+            void reporter_loop();
+
+            size_t fill_cache(
+                packet_template* packet,
+                data_generator* generator,
+                vector_t<byte_t>& cache);
+
+            static void producer_proc(
+                data_dispatcher* dispatcher,
+                packet_template* packet,
+                packet_ring* ring,
+                stats::counters* counters);
+
+            void producer_loop(
+                packet_template* packet,
+                packet_ring* ring,
+                stats::counters* counters);
+
+            void send_batch(
+                data_output* output, vector_t<data_output::span>& batch);
+
+            void flush(
+                data_output* output,
+                vector_t<data_output::span>& batch,
+                bool& flushed);
+
+            void count_failures(
+                stats::counters* counters,
+                data_output* output,
+                size_t size,
+                size_t& failure_count);
+
+            bool is_limit_final(
+                data_output* output,
+                vector_t<data_output::span>& batch,
+                bool& flushed,
+                stats::counters* counters,
+                size_t size,
+                size_t& failure_count);
+
+            duration_t next_delay(size_t size);
+            void wait_for_delay(duration_t time_left);
+            void wait_for_resume();
+            void wait_for_ring();
+            bool claim_packet(size_t index, size_t size);
             bool is_limit_reached() const;
             void limit_reached();
             void thread_exception(const exception_t& exception);
@@ -35,31 +35,63 @@ namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
 
+    class generator_group;
+
     class data_generator :
-        public observable<generator_listener>
+        public observable<generator_listener>, protected generator_listener
     {
+        public:
+            using clone_map_t =
+                unordered_map_t<const data_generator*, data_generator*>;
+
+            static const size_t PERIOD_UNKNOWN = 0;
+
         private:
             vector_t<data_transformation*> _transformations;
+            mutable vector_t<byte_t> _transformation_buffer;
+            mutable size_t _size = 0;
+            mutable bool _size_known = false;
 
         public:
             virtual ~data_generator() {}
+            data_generator* clone() const;
             size_t transformation_count() const;
             data_transformation* transformation_at(const size_t pos) const;
             void add_transformation(data_transformation* transformation);
             void remove_transformation_at(const size_t pos);
             size_t size() const;
-            virtual void next(bool data_changed = true) = 0;
+            virtual void next(
+                bool data_changed = true, size_t stride = 1) = 0;
             virtual void reset(bool data_changed = true) = 0;
             byte_t* to_buffer(byte_t* buffer, size_t size) const;
 
+            virtual bool render_batch(
+                byte_t* buffer,
+                size_t stride,
+                size_t count,
+                size_t step = 1) const;
+
+            virtual bool is_constant() const;
+            virtual const generator_group* get_layout() const;
+            virtual size_t get_period(size_t max_period) const;
+
         protected:
             virtual size_t data_size() const = 0;
 
             virtual byte_t* data_to_buffer(
                 byte_t* buffer, size_t size) const = 0;
 
+            virtual data_generator* create_clone(
+                clone_map_t& clones) const = 0;
+
         protected:
             void data_changed();
+            virtual void layout_changed();
+            void on_data_changed();
+            void clone_transformations(data_generator* clone) const;
+
+            static data_generator* clone_of(
+                const data_generator* generator, clone_map_t& clones);
 
     }; /* data_generator */
 
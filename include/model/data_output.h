@@ -36,10 +36,24 @@ namespace hyenae::model
     class data_output
     {
         public:
+            class span
+            {
+                public:
+                    byte_t* data;
+                    size_t size;
+
+            }; /* span */
+
             virtual ~data_output() {}
             virtual void open() = 0;
             virtual void close() noexcept = 0;
             virtual void send(byte_t* data, size_t size) = 0;
+            virtual void send_batch(const vector_t<span>& packets);
+            virtual data_output* clone() const { return NULL; }
+            virtual byte_t* reserve(size_t size) { return NULL; }
+            virtual void commit(size_t size) {}
+            virtual void flush() {}
+            virtual size_t get_failure_count() const { return 0; }
 
     }; /* data_output */
 
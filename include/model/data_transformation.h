@@ -38,7 +38,18 @@ namespace hyenae::model
         public:
             virtual ~data_transformation() {};
             virtual size_t result_size(size_t data_size) const = 0;
-            virtual byte_t* transform(byte_t* data, size_t size) const = 0;
+
+            virtual void transform(
+                const byte_t* data, size_t size, byte_t* result) const = 0;
+
+            virtual bool is_incremental() const { return false; }
+
+            virtual void update(
+                byte_t* result,
+                const byte_t* old_data,
+                const byte_t* new_data,
+                size_t size,
+                size_t offset) const {}
 
     }; /* data_transformation */
 
@@ -40,15 +40,22 @@ namespace hyenae::model::data_transformations
             static const uint32_t POLYNOMIAL_ETHERNET = 0xEDB88320;
 
         private:
+            static const size_t SLICES = 8;
+
             uint32_t _polynomial;
+            uint32_t _table[SLICES][256];
 
         public:
             to_crc32_checksum(uint32_t polynomial);
             size_t result_size(size_t data_size) const;
-            byte_t* transform(byte_t* data, size_t size) const;
+            void transform(
+                const byte_t* data, size_t size, byte_t* result) const;
 
         private:
-            uint32_t checksum(byte_t* data, size_t size) const;
+            uint32_t checksum(const byte_t* data, size_t size) const;
+
+            uint32_t update_crc(
+                uint32_t crc, const byte_t* data, size_t size) const;
 
     }; /* to_crc32_checksum */
 
@@ -42,10 +42,24 @@ namespace hyenae::model::data_transformations
         public:
             static to_internet_checksum* get_instance();
             size_t result_size(size_t data_size) const;
-            byte_t* transform(byte_t* data, size_t size) const;
 
-        private:
-            uint16_t checksum(byte_t* data, size_t size) const;
+            void transform(
+                const byte_t* data, size_t size, byte_t* result) const;
+
+            bool is_incremental() const;
+
+            void update(
+                byte_t* result,
+                const byte_t* old_data,
+                const byte_t* new_data,
+                size_t size,
+                size_t offset) const;
+
+            static uint16_t sum(
+                const byte_t* data, size_t size, bool odd_offset = false);
+
+            static uint16_t adjust(
+                uint16_t checksum, uint16_t old_sum, uint16_t new_sum);
 
     }; /* to_internet_checksum */
 
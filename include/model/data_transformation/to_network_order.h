@@ -41,7 +41,8 @@ namespace hyenae::model::data_transformations
 
         public:
             static to_network_order* get_instance();
-            byte_t* transform(byte_t* data, size_t size) const;
+            void transform(
+                const byte_t* data, size_t size, byte_t* result) const;
 
     }; /* to_network_order */
 
@@ -42,7 +42,8 @@ namespace hyenae::model::data_transformations
         public:
             static to_reverse_order* get_instance();
             size_t result_size(size_t data_size) const;
-            byte_t* transform(byte_t* data, size_t size) const;
+            void transform(
+                const byte_t* data, size_t size, byte_t* result) const;
 
     }; /* to_reverse_order */
 
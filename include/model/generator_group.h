@@ -34,25 +34,38 @@ namespace hyenae::model
     /*---------------------------------------------------------------------- */
 
     class generator_group :
-        public data_generator, generator_listener
+        public data_generator
     {
         private:
             vector_t<data_generator*> _generators;
+            vector_t<data_generator*> _owned_generators;
+            mutable vector_t<data_generator*> _varying_generators;
+            mutable bool _varying_known = false;
 
         public:
+            ~generator_group();
             size_t generator_count() const;
             data_generator* generator_at(const size_t pos) const;
             void add_generator(data_generator* generator);
+            void adopt_generator(data_generator* generator);
             void remove_generator_at(const size_t pos);
-            void next(bool data_changed = true);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+            bool is_constant() const;
+            const generator_group* get_layout() const;
+            size_t get_period(size_t max_period) const;
+
+            void clone_generators(
+                generator_group* group, clone_map_t& clones) const;
 
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
+            void layout_changed();
 
-        protected:
-            void on_data_changed();
+        private:
+            const vector_t<data_generator*>& get_varying_generators() const;
 
     }; /* generator_group */
 
@@ -40,6 +40,7 @@ namespace hyenae::model::generators
             byte_t* _data;
             size_t _size;
             bool _free_on_destruction = false;
+            bool _constant = true;
 
         public:
             fixed_data_generator(uint8_t value);
@@ -53,8 +54,10 @@ namespace hyenae::model::generators
             static fixed_data_generator* allocate_uint32();
             static fixed_data_generator* allocate_uint64();
             static fixed_data_generator* allocate(size_t size);
-            void next(bool data_changed = true) {};
+            void next(bool data_changed = true, size_t stride = 1) {};
             void reset(bool data_changed = true) {};
+            bool is_constant() const;
+            void set_constant(bool constant);
             uint8_t get_uint8() const;
             uint16_t get_uint16() const;
             uint32_t get_uint32() const;
@@ -67,6 +70,7 @@ namespace hyenae::model::generators
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
 
     }; /* fixed_data_generator */
 
@@ -28,6 +28,7 @@
 #define INTEGER_GENERATOR_H
 
 #include "../data_generator.h"
+#include "../random_engine.h"
 
 namespace hyenae::model::generators
 {
@@ -59,6 +60,15 @@ namespace hyenae::model::generators
             static const char DECR_WILDCARD = '-';
 
         private:
+            struct wildcard
+            {
+                char chr;
+                uint64_t weight;
+                uint64_t max_digit;
+                bool chained;
+
+            }; /* wildcard */
+
             static const char* BASE_CHARS;
             string_t _pattern;
             size_t _pattern_len;
@@ -68,6 +78,17 @@ namespace hyenae::model::generators
             uint64_t _result_max;
             uint64_t _result;
             uint64_t _offset;
+            uint64_t _constant;
+            vector_t<wildcard> _wildcards;
+            bool _wraps;
+            mutable vector_t<uint64_t> _rand_digits;
+            mutable random_engine _random;
+            mutable random_engine _ahead_random;
+            mutable vector_t<uint64_t> _ahead_results;
+            mutable vector_t<uint64_t> _ahead_offsets;
+            mutable vector_t<uint64_t> _ahead_digits;
+            mutable size_t _ahead_pos;
+            mutable size_t _ahead_step;
 
         public:
             integer_generator(
@@ -85,8 +106,22 @@ namespace hyenae::model::generators
             static integer_generator* create_uint64(
                 const string_t& pattern, size_t base);
 
-            void next(bool data_changed = true);
+            string_t get_pattern() const;
+            size_t get_base() const;
+            size_t get_bits() const;
+            uint64_t get_seed() const;
+            void set_seed(uint64_t seed);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+
+            bool render_batch(
+                byte_t* buffer,
+                size_t stride,
+                size_t count,
+                size_t step = 1) const;
+
+            bool is_constant() const;
+            size_t get_period(size_t max_period) const;
             uint8_t get_uint8() const;
             uint16_t get_uint16() const;
             uint32_t get_uint32() const;
@@ -95,7 +130,8 @@ namespace hyenae::model::generators
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
-            
+            data_generator* create_clone(clone_map_t& clones) const;
+
         private:
             static uint64_t int_max(size_t bits);
             static size_t bit_to_byte_size(size_t bits);
@@ -113,7 +149,15 @@ namespace hyenae::model::generators
 
             uint64_t result_min(uint64_t max) const;
             uint64_t result_max(uint64_t max) const;
-            uint64_t result() const;
+            void compile();
+            uint64_t result(uint64_t offset) const;
+
+            uint64_t result(
+                uint64_t offset, const uint64_t* rand_digits) const;
+
+            void step(uint64_t& offset, uint64_t& result) const;
+            void render_ahead(size_t count, size_t step) const;
+            void drop_ahead() const;
 
     }; /* integer_generator */
 
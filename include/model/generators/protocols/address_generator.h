@@ -50,9 +50,12 @@ namespace hyenae::model::generators::protocols
 
         private:
             generator_group* _address;
+            string_t _pattern;
             size_t _field_count;
             size_t _field_bits;
             size_t _base;
+            char _field_delimiter;
+            data_transformation* _field_transformation;
 
         public:
             address_generator(
@@ -77,8 +80,18 @@ namespace hyenae::model::generators::protocols
                 const string_t& pattern = RAND_IP_V6_PATTERN,
                 data_transformation* field_transformation = NULL);
 
-            void next(bool data_changed = true);
+            string_t get_pattern() const;
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+
+            bool render_batch(
+                byte_t* buffer,
+                size_t stride,
+                size_t count,
+                size_t step = 1) const;
+
+            bool is_constant() const;
+            const generator_group* get_layout() const;
             void to_mac_address(mac_address_t& result) const;
             void to_ip_v4_address(ip_v4_address_t& result) const;
             void to_ip_v6_address(ip_v6_address_t& result) const;
@@ -86,6 +99,7 @@ namespace hyenae::model::generators::protocols
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
 
         private:
             static generator_group* parse_address(
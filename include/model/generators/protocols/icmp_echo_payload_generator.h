@@ -64,12 +64,15 @@ namespace hyenae::model::generators::protocols
                 size_t seq_num_pattern_base = 10);
 
             ~icmp_echo_payload_generator();
-            void next(bool data_changed = true);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+            bool is_constant() const;
+            const generator_group* get_layout() const;
 
             protected:
                 size_t data_size() const;
                 byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+                data_generator* create_clone(clone_map_t& clones) const;
 
     }; /* icmp_echo_payload_generator */
 
@@ -51,6 +51,7 @@ namespace hyenae::model::generators::protocols
             static const uint8_t IP_V6_PROTOCOL = 58;
 
         private:
+            data_generator* _pseudo_header = NULL;
             fixed_data_generator* _type = NULL;
             fixed_data_generator* _code = NULL;
             generator_group* _checksum = NULL;
@@ -64,13 +65,16 @@ namespace hyenae::model::generators::protocols
                 uint8_t code = 0);
 
             ~icmp_v6_frame_generator();
-            void next(bool data_changed = true);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+            bool is_constant() const;
+            const generator_group* get_layout() const;
             generator_group* get_payload();
 
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
 
     }; /* icmp_v6_frame_generator */
 
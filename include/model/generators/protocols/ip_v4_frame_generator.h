@@ -89,14 +89,18 @@ namespace hyenae::model::generators::protocols
                     address_generator::RAND_IP_V4_PATTERN);
 
             ~ip_v4_frame_generator();
-            void next(bool data_changed = true);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+            bool is_constant() const;
+            const generator_group* get_layout() const;
             generator_group* get_payload();
             data_generator* get_pseudo_header() const;
 
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
+            void layout_changed();
             void update_payload_length();
             void update_flags_frag_offset();
 
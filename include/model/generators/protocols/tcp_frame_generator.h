@@ -57,6 +57,7 @@ namespace hyenae::model::generators::protocols
         private:
             static const uint8_t DATA_OFFSET = 0X50;
 
+            data_generator* _pseudo_header = NULL;
             integer_generator* _src_port = NULL;
             integer_generator* _dst_port = NULL;
             integer_generator* _seq_num = NULL;
@@ -95,13 +96,16 @@ namespace hyenae::model::generators::protocols
                 size_t urg_pointer_pattern_base = 10);
 
             ~tcp_frame_generator();
-            void next(bool data_changed = true);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+            bool is_constant() const;
+            const generator_group* get_layout() const;
             generator_group* get_payload();
 
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
 
     }; /* tcp_frame_generator */
 
@@ -55,6 +55,7 @@ namespace hyenae::model::generators::protocols
             static const uint8_t IP_V6_NEXT_HEADER = 0x11;
 
         private:
+            data_generator* _pseudo_header = NULL;
             integer_generator* _src_port = NULL;
             integer_generator* _dst_port = NULL;
             fixed_data_generator* _length = NULL;
@@ -72,13 +73,17 @@ namespace hyenae::model::generators::protocols
                 size_t dst_port_pattern_base = 10);
 
             ~udp_frame_generator();
-            void next(bool data_changed = true);
+            void next(bool data_changed = true, size_t stride = 1);
             void reset(bool data_changed = true);
+            bool is_constant() const;
+            const generator_group* get_layout() const;
             generator_group* get_payload();
 
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
+            void layout_changed();
 
         private:
             void update_length();
@@ -50,12 +50,14 @@ namespace hyenae::model::generators
 
         public:
             string_generator(const string_t& pattern, encoding encoding);
-            void next(bool data_changed = true) {}
+            void next(bool data_changed = true, size_t stride = 1) {}
             void reset(bool data_changed = true) {}
+            bool is_constant() const { return true; }
 
         protected:
             size_t data_size() const;
             byte_t* data_to_buffer(byte_t* buffer, size_t size) const;
+            data_generator* create_clone(clone_map_t& clones) const;
 
         private:
             size_t data_size(encoding encoding) const;
@@ -0,0 +1,88 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CAPTURE_FILE_OUTPUT_H
+#define CAPTURE_FILE_OUTPUT_H
+
+#include "../../file_io.h"
+#include "../../model/data_output.h"
+
+namespace hyenae::model::outputs
+{
+    /*---------------------------------------------------------------------- */
+
+    class capture_file_output :
+        public data_output
+    {
+        public:
+            enum class format
+            {
+                PCAP,
+                PCAPNG
+
+            }; /* format */
+
+            static const size_t DEFAULT_BUFFER_SIZE = 1048576;
+            static const size_t BUFFER_ALIGNMENT = 4096;
+            static const uint32_t SNAP_LENGTH = 262144;
+            static const uint16_t LINK_TYPE_ETHERNET = 1;
+
+        private:
+            file_io* _file_io = NULL;
+            string_t _path;
+            format _format;
+            bool _nanosecond_resolution;
+            byte_t* _buffer = NULL;
+            size_t _buffer_size;
+            size_t _buffer_pos = 0;
+
+        public:
+            capture_file_output(
+                file_io::provider file_io_provider,
+                const string_t& path,
+                format format = format::PCAP,
+                bool nanosecond_resolution = false,
+                size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+            ~capture_file_output();
+            void open();
+            void close() noexcept;
+            void send(byte_t* data, size_t size);
+
+        private:
+            void write_pcap_header();
+            void write_pcapng_header();
+            void write_record(byte_t* data, size_t size, uint64_t timestamp);
+            void write(const void* data, size_t size);
+            void write_buffer();
+
+    }; /* capture_file_output */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model::outputs */
+
+#endif /* CAPTURE_FILE_OUTPUT_H */
@@ -40,6 +40,7 @@ namespace hyenae::model::outputs
         private:
             file_io* _file_io = NULL;
             string_t _path;
+            vector_t<byte_t> _batch_buffer;
             
         public:
             file_output(
@@ -50,6 +51,7 @@ namespace hyenae::model::outputs
             void open();
             void close() noexcept;
             void send(byte_t* data, size_t size);
+            void send_batch(const vector_t<span>& packets);
 
     }; /* file_output */
 
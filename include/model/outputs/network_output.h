@@ -27,10 +27,15 @@
 #ifndef NETWORK_OUTPUT_H
 #define NETWORK_OUTPUT_H
 
+#include "../../os.h"
 #include "../../model/data_output.h"
 
 #include <pcap.h>
 
+#ifdef OS_LINUX
+    #include <sys/socket.h>
+#endif
+
 namespace hyenae::model::outputs
 {
     /*---------------------------------------------------------------------- */
@@ -55,6 +60,12 @@ namespace hyenae::model::outputs
         private:
             device* _device;
             pcap_t* _pcap = NULL;
+            size_t _failure_count = 0;
+
+            #ifdef OS_LINUX
+                vector_t<mmsghdr> _messages;
+                vector_t<iovec> _vectors;
+            #endif
 
         public:
             network_output(device* device);
@@ -63,6 +74,12 @@ namespace hyenae::model::outputs
             void open();
             void close() noexcept;
             void send(byte_t* data, size_t size);
+            void send_batch(const vector_t<span>& packets);
+            data_output* clone() const;
+            size_t get_failure_count() const;
+
+        private:
+            static bool is_transient_failure();
 
     }; /* network_output */
 
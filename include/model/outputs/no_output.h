@@ -41,6 +41,7 @@ namespace hyenae::model::outputs
             void open() {}
             void close() noexcept {}
             void send(byte_t* data, size_t size) {};
+            data_output* clone() const { return new no_output(); }
 
     }; /* no_output */
 
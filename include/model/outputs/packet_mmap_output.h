@@ -0,0 +1,93 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PACKET_MMAP_OUTPUT_H
+#define PACKET_MMAP_OUTPUT_H
+
+#include "../../model/data_output.h"
+#include "../../model/outputs/network_output.h"
+
+namespace hyenae::model::outputs
+{
+    /*---------------------------------------------------------------------- */
+
+    class packet_mmap_output :
+        public data_output
+    {
+        public:
+            static const size_t FRAME_SIZE_AUTO = 0;
+            static const size_t DEFAULT_FRAME_SIZE = 2048;
+            static const size_t DEFAULT_FRAME_COUNT = 4096;
+            static const size_t DEFAULT_BATCH_SIZE = 64;
+
+        private:
+            network_output::device* _device;
+            size_t _frame_size;
+            size_t _frame_count;
+            size_t _batch_size;
+            size_t _ring_frame_size = 0;
+            size_t _ring_frame_count = 0;
+            size_t _block_size = 0;
+            size_t _block_count = 0;
+            size_t _frames_per_block = 0;
+            int _socket = -1;
+            byte_t* _ring = NULL;
+            size_t _frame_pos = 0;
+            size_t _pending = 0;
+            size_t _failure_count = 0;
+
+        public:
+            packet_mmap_output(
+                network_output::device* device,
+                size_t frame_size = FRAME_SIZE_AUTO,
+                size_t frame_count = DEFAULT_FRAME_COUNT,
+                size_t batch_size = DEFAULT_BATCH_SIZE);
+
+            ~packet_mmap_output();
+            static bool is_supported();
+            void open();
+            void close() noexcept;
+            void send(byte_t* data, size_t size);
+            void send_batch(const vector_t<span>& packets);
+            data_output* clone() const;
+            byte_t* reserve(size_t size);
+            void commit(size_t size);
+            void flush();
+            size_t get_failure_count() const;
+
+        private:
+            void setup_ring();
+            byte_t* frame_at(size_t pos) const;
+            bool is_available(size_t pos) const;
+            bool kick(bool wait);
+
+    }; /* packet_mmap_output */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model::outputs */
+
+#endif /* PACKET_MMAP_OUTPUT_H */
@@ -0,0 +1,69 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PACKET_RING_H
+#define PACKET_RING_H
+
+#include "../common.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    // Lock-free ring of fixed-size packet slots, filled by exactly
+    // one producer thread and drained by exactly one consumer thread.
+
+    class packet_ring
+    {
+        private:
+            vector_t<byte_t> _buffer;
+            size_t _depth;
+            size_t _slot_size;
+            atomic_t<bool> _closed = false;
+            alignas(CACHE_LINE_SIZE) atomic_t<size_t> _head = 0;
+            alignas(CACHE_LINE_SIZE) atomic_t<size_t> _tail = 0;
+
+        public:
+            packet_ring(size_t depth, size_t slot_size);
+            size_t get_depth() const;
+            size_t get_slot_size() const;
+            byte_t* reserve();
+            void commit();
+            byte_t* peek() const;
+            void release();
+            void close();
+            bool is_closed() const;
+
+        private:
+            byte_t* slot_at(size_t index) const;
+
+    }; /* packet_ring */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
+
+#endif /* PACKET_RING_H */
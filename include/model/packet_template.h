@@ -0,0 +1,126 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PACKET_TEMPLATE_H
+#define PACKET_TEMPLATE_H
+
+#include "data_generator.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    class packet_template
+    {
+        public:
+            static const size_t BATCH_COUNT = 64;
+
+            class field
+            {
+                private:
+                    size_t _offset;
+                    const data_generator* _source;
+                    vector_t<byte_t> _data;
+
+                public:
+                    field(size_t offset, const data_generator* source);
+                    size_t get_offset() const;
+                    size_t get_size() const;
+                    const data_generator* get_source() const;
+                    byte_t* get_data();
+
+            }; /* field */
+
+            class patch
+            {
+                private:
+                    size_t _offset;
+                    size_t _size;
+                    const data_generator* _source;
+                    vector_t<field> _fields;
+                    vector_t<byte_t> _column;
+
+                public:
+                    patch(
+                        size_t offset,
+                        size_t size,
+                        const data_generator* source);
+
+                    size_t get_offset() const;
+                    size_t get_size() const;
+                    const data_generator* get_source() const;
+                    bool is_incremental() const;
+                    size_t field_count() const;
+                    field* field_at(size_t pos);
+                    void add_field(const field& field);
+                    bool is_batched() const;
+                    void set_batched(bool batched);
+                    byte_t* get_column();
+
+            }; /* patch */
+
+        private:
+            data_generator* _generator;
+            size_t _step;
+            size_t _row;
+            vector_t<byte_t> _data;
+            vector_t<byte_t> _field_buffer;
+            vector_t<patch> _patches;
+
+        public:
+            packet_template(data_generator* generator, size_t step = 1);
+            void compile();
+            size_t size() const;
+            size_t patch_count() const;
+            const patch* patch_at(size_t pos) const;
+            byte_t* render();
+            void next();
+
+        private:
+            using action_t = func_t<void(const data_generator*, size_t)>;
+
+            static void compile(
+                const data_generator* generator,
+                size_t offset,
+                action_t action);
+
+            static void compile_layout(
+                const generator_group* layout,
+                size_t offset,
+                action_t action);
+
+            static bool is_incremental(const data_generator* generator);
+            void compile_patch(const data_generator* generator, size_t offset);
+            void update(patch& patch);
+            void render_batch();
+
+    }; /* packet_template */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
+
+#endif /* PACKET_TEMPLATE_H */
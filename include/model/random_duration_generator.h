@@ -28,6 +28,7 @@
 #define RANDOM_DURATION_GENERATOR_H
 
 #include "duration_generator.h"
+#include "random_engine.h"
 
 namespace hyenae::model
 {
@@ -39,6 +40,7 @@ namespace hyenae::model
         private:
             duration_t _min_duration;
             duration_t _max_duration;
+            random_engine _random;
 
         public:
             random_duration_generator(
@@ -46,6 +48,8 @@ namespace hyenae::model
 
             duration_t get_min_duration();
             duration_t get_max_duration();
+            uint64_t get_seed() const;
+            void set_seed(uint64_t seed);
             duration_t next();
             void reset() {}
 
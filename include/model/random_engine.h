@@ -0,0 +1,67 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RANDOM_ENGINE_H
+#define RANDOM_ENGINE_H
+
+#include "../common.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    class random_engine
+    {
+        private:
+            static atomic_t<uint64_t> _seed_sequence;
+
+            uint64_t _seed;
+            uint64_t _state[4];
+
+        public:
+            random_engine();
+            random_engine(uint64_t seed);
+
+            static void set_default_seed(uint64_t seed);
+            uint64_t get_seed() const;
+            void seed(uint64_t seed);
+            uint64_t next();
+            uint64_t next(uint64_t bound);
+            void fill(uint64_t* values, size_t count, uint64_t bound);
+
+        private:
+            uint64_t next(uint64_t bound, uint64_t threshold);
+            static uint64_t threshold(uint64_t bound);
+            static uint64_t split_mix(uint64_t& state);
+            static uint64_t rotate_left(uint64_t value, int count);
+
+    }; /* random_engine */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
+
+#endif /* RANDOM_ENGINE_H */
@@ -0,0 +1,72 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TOKEN_BUCKET_H
+#define TOKEN_BUCKET_H
+
+#include "../common.h"
+#include "../monotonic_clock.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    class token_bucket
+    {
+        public:
+            static const uint64_t RATE_UNLIMITED = 0;
+
+        private:
+            uint64_t _packet_rate;
+            uint64_t _bit_rate;
+            size_t _burst_size;
+            double _packet_cost;
+            double _bit_cost;
+            duration_t _started_at;
+            atomic_t<int64_t> _next_at;
+
+        public:
+            token_bucket(
+                uint64_t packet_rate,
+                uint64_t bit_rate,
+                size_t burst_size = 1);
+
+            uint64_t get_packet_rate() const;
+            uint64_t get_bit_rate() const;
+            size_t get_burst_size() const;
+            duration_t consume(size_t size);
+            void reset();
+
+        private:
+            int64_t now() const;
+
+    }; /* token_bucket */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
+
+#endif /* TOKEN_BUCKET_H */
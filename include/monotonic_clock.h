@@ -0,0 +1,68 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MONOTONIC_CLOCK_H
+#define MONOTONIC_CLOCK_H
+
+#include "common.h"
+
+namespace hyenae
+{
+    /*---------------------------------------------------------------------- */
+
+    class monotonic_clock
+    {
+        private:
+            struct calibration
+            {
+                bool tsc_based;
+                uint64_t base_ticks;
+                double ns_per_tick;
+                int64_t base_ns;
+                int64_t epoch_offset_ns;
+
+            }; /* calibration */
+
+            static const int64_t CALIBRATION_NS = 10000000;
+
+        public:
+            static duration_t now();
+            static duration_t since_epoch();
+            static bool is_tsc_based();
+
+        private:
+            static int64_t now_ns();
+            static int64_t steady_ns();
+            static const calibration& get_calibration();
+            static calibration calibrate();
+
+    }; /* monotonic_clock */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae */
+
+#endif /* MONOTONIC_CLOCK_H */
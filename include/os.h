@@ -29,10 +29,10 @@
 
 #if defined(_WIN32) || defined(_WIN64)
     #define OS_WINDOWS
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__FreeBSD__)
-    #define OS_UNIX
 #elif defined(linux) || defined(__linux) || defined(__linux__)
     #define OS_LINUX
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__FreeBSD__)
+    #define OS_UNIX
 #elif defined(__APPLE__) || defined(__MACH__)
     #define OS_OSX
 #else
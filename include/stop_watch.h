@@ -28,6 +28,7 @@
 #define STOP_WATCH_H
 
 #include "common.h"
+#include "monotonic_clock.h"
 
 namespace hyenae
 {
@@ -35,15 +36,17 @@ namespace hyenae
 
     class stop_watch
     {
-        using clock_t = std::chrono::system_clock;
-
         private:
+            bool _started;
+            bool _stopped;
             duration_t _started_at;
             duration_t _stopped_at;
 
         public:
             stop_watch();
             duration_t get_time_passed() const;
+            duration_t get_time_passed(duration_t now) const;
+            void start(duration_t now);
             void start();
             void stop();
             void reset();
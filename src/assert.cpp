@@ -100,7 +100,7 @@ namespace hyenae
     /*---------------------------------------------------------------------- */
 
     void assert::argument_not_null(
-        void* pointer, string_t param_name, string_t message)
+        const void* pointer, string_t param_name, string_t message)
     {
         valid_argument(
             pointer != NULL, param_name, message != "" ? message : "is null");
@@ -0,0 +1,120 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/bench/allocation_counter.h"
+
+#include <new>
+#include <cstdlib>
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    atomic_t<uint64_t> allocation_counter::_count = 0;
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t allocation_counter::get_count()
+    {
+        return _count.load(std::memory_order_relaxed);
+
+    } /* get_count */
+
+    /*---------------------------------------------------------------------- */
+
+    void allocation_counter::increment()
+    {
+        _count.fetch_add(1, std::memory_order_relaxed);
+
+    } /* increment */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
+
+/*---------------------------------------------------------------------- */
+
+// Replacing the global allocation functions counts every allocation made
+// through new (including those of standard containers) within the
+// benchmark binary. Over-aligned allocations aren't counted, since none
+// of the benchmarked code paths make any.
+
+void* operator new(std::size_t size)
+{
+    void* ptr = NULL;
+
+    hyenae::bench::allocation_counter::increment();
+
+    if ((ptr = std::malloc(size > 0 ? size : 1)) == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+
+} /* operator new */
+
+/*---------------------------------------------------------------------- */
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+
+} /* operator new[] */
+
+/*---------------------------------------------------------------------- */
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+
+} /* operator delete */
+
+/*---------------------------------------------------------------------- */
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    std::free(ptr);
+
+} /* operator delete */
+
+/*---------------------------------------------------------------------- */
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+
+} /* operator delete[] */
+
+/*---------------------------------------------------------------------- */
+
+void operator delete[](void* ptr, std::size_t size) noexcept
+{
+    std::free(ptr);
+
+} /* operator delete[] */
+
+/*---------------------------------------------------------------------- */
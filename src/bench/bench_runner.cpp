@@ -0,0 +1,285 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/monotonic_clock.h"
+#include "../../include/bench/bench_runner.h"
+#include "../../include/bench/allocation_counter.h"
+
+#include <cstdio>
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    bench_runner::bench_runner(const string_t& filter, duration_t min_time)
+    {
+        assert::in_range(min_time.count() > 0, "min_time");
+
+        _filter = filter;
+        _min_time = min_time;
+
+    } /* bench_runner */
+
+    /*---------------------------------------------------------------------- */
+
+    bool bench_runner::is_selected(const string_t& name) const
+    {
+        return _filter == "" || name.find(_filter) != string_t::npos;
+
+    } /* is_selected */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t bench_runner::get_min_time() const
+    {
+        return _min_time;
+
+    } /* get_min_time */
+
+    /*---------------------------------------------------------------------- */
+
+    void bench_runner::run(
+        const string_t& name,
+        size_t bytes_per_op,
+        bool packets,
+        op_t op)
+    {
+        size_t iterations = MIN_ITERATIONS;
+        duration_t started_at = duration_t::zero();
+        duration_t duration = duration_t::zero();
+        uint64_t allocations = 0;
+
+        if (is_selected(name))
+        {
+            // The iteration count grows until a single pass takes at
+            // least the min. time, so that the shorter passes before
+            // also serve as warm-up.
+
+            while (true)
+            {
+                allocations = allocation_counter::get_count();
+                started_at = monotonic_clock::now();
+
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    op();
+                }
+
+                duration = monotonic_clock::now() - started_at;
+                allocations = allocation_counter::get_count() - allocations;
+
+                if (duration >= _min_time || iterations >= MAX_ITERATIONS)
+                {
+                    break;
+                }
+
+                if (duration * 10 < _min_time)
+                {
+                    iterations *= 10;
+                }
+                else
+                {
+                    iterations = (size_t)(
+                        (double)iterations * 1.2 *
+                        _min_time.count() / duration.count()) + 1;
+                }
+
+                iterations = std::min(iterations, MAX_ITERATIONS);
+            }
+
+            _results.push_back({
+                name,
+                iterations,
+                duration,
+                allocations,
+                bytes_per_op,
+                packets });
+        }
+
+    } /* run */
+
+    /*---------------------------------------------------------------------- */
+
+    void bench_runner::add(const result& result)
+    {
+        // Results of benchmarks that can't be run as a loop of single
+        // operations (e.g. a dispatcher running for a fixed time).
+
+        assert::in_range(result.iterations > 0, "iterations");
+        assert::in_range(result.duration.count() > 0, "duration");
+
+        _results.push_back(result);
+
+    } /* add */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t bench_runner::result_count() const
+    {
+        return _results.size();
+
+    } /* result_count */
+
+    /*---------------------------------------------------------------------- */
+
+    const bench_runner::result& bench_runner::result_at(size_t pos) const
+    {
+        assert::in_range(pos < _results.size(), "pos");
+
+        return _results.at(pos);
+
+    } /* result_at */
+
+    /*---------------------------------------------------------------------- */
+
+    string_t bench_runner::to_json(const string_t& label) const
+    {
+        string_t json = "{\n";
+
+        json.append("  \"label\": " + to_json_string(label) + ",\n");
+
+        json.append(
+            "  \"clock\": " +
+            to_json_string(
+                monotonic_clock::is_tsc_based() ? "tsc" : "steady") + ",\n");
+
+        json.append(
+            "  \"min_time_ms\": " + std::to_string(to_ms(_min_time)) + ",\n");
+
+        json.append("  \"benchmarks\": [");
+
+        for (size_t i = 0; i < _results.size(); i++)
+        {
+            json.append(i > 0 ? ",\n" : "\n");
+            json.append(to_json(_results.at(i)));
+        }
+
+        json.append("\n  ]\n}\n");
+
+        return json;
+
+    } /* to_json */
+
+    /*---------------------------------------------------------------------- */
+
+    string_t bench_runner::to_json(const result& result)
+    {
+        double ns = (double)std::chrono::duration_cast<
+            std::chrono::nanoseconds>(result.duration).count();
+
+        double ops_per_sec = result.iterations * 1e9 / ns;
+        string_t json = "    {\n";
+
+        json.append("      \"name\": " + to_json_string(result.name) + ",\n");
+
+        json.append(
+            "      \"iterations\": " +
+            std::to_string(result.iterations) + ",\n");
+
+        json.append(
+            "      \"ns_per_op\": " +
+            to_fixed_string(ns / result.iterations) + ",\n");
+
+        json.append(
+            "      \"ops_per_sec\": " + to_fixed_string(ops_per_sec) + ",\n");
+
+        if (result.packets)
+        {
+            json.append(
+                "      \"packets_per_sec\": " +
+                to_fixed_string(ops_per_sec) + ",\n");
+        }
+
+        json.append(
+            "      \"bytes_per_op\": " +
+            std::to_string(result.bytes_per_op) + ",\n");
+
+        json.append(
+            "      \"mbit_per_sec\": " +
+            to_fixed_string(ops_per_sec * result.bytes_per_op * 8 / 1e6) +
+            ",\n");
+
+        json.append(
+            "      \"allocs_per_op\": " +
+            to_fixed_string(
+                (double)result.allocations / result.iterations));
+
+        for (auto& metric : result.metrics)
+        {
+            json.append(
+                ",\n      " + to_json_string(metric.name) + ": " +
+                to_fixed_string(metric.value));
+        }
+
+        json.append("\n");
+
+        json.append("    }");
+
+        return json;
+
+    } /* to_json */
+
+    /*---------------------------------------------------------------------- */
+
+    string_t bench_runner::to_json_string(const string_t& value)
+    {
+        string_t json = "\"";
+
+        for (auto chr : value)
+        {
+            if (chr == '"' || chr == '\\')
+            {
+                json.push_back('\\');
+                json.push_back(chr);
+            }
+            else if ((unsigned char)chr >= 0x20)
+            {
+                json.push_back(chr);
+            }
+        }
+
+        json.push_back('"');
+
+        return json;
+
+    } /* to_json_string */
+
+    /*---------------------------------------------------------------------- */
+
+    string_t bench_runner::to_fixed_string(double value)
+    {
+        char buffer[64];
+
+        snprintf(buffer, sizeof(buffer), "%.3f", value);
+
+        return buffer;
+
+    } /* to_fixed_string */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
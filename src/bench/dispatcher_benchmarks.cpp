@@ -0,0 +1,377 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/os.h"
+#include "../../include/assert.h"
+#include "../../include/bench/benchmarks.h"
+#include "../../include/bench/allocation_counter.h"
+#include "../../include/model/data_dispatcher.h"
+#include "../../include/model/outputs/network_output.h"
+#include "../../include/model/outputs/packet_mmap_output.h"
+#include "../../include/model/generators/string_generator.h"
+#include "../../include/model/generators/protocols/ethernet_frame_generator.h"
+#include "../../include/model/generators/protocols/ip_v4_frame_generator.h"
+#include "../../include/model/generators/protocols/udp_frame_generator.h"
+
+#ifdef OS_POSIX
+    #include <sys/resource.h>
+#endif
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    using namespace model::generators::protocols;
+
+    using data_generator_t = model::data_generator;
+    using data_output_t = model::data_output;
+    using data_dispatcher_t = model::data_dispatcher;
+    using network_output_t = model::outputs::network_output;
+    using packet_mmap_output_t = model::outputs::packet_mmap_output;
+    using device_t = network_output_t::device;
+
+    /*---------------------------------------------------------------------- */
+
+    // Frame sizes as passed to the output (without FCS), from the
+    // smallest ethernet frame up to a jumbo frame.
+
+    static const size_t FRAME_SIZES[] = { 64, 512, 1518, 9000 };
+
+    // Ethernet, IPv4 and UDP header
+
+    static const size_t HEADER_SIZE = 14 + 20 + 8;
+
+    /*---------------------------------------------------------------------- */
+
+    class error_listener :
+        public model::dispatcher_listener
+    {
+        private:
+            string_t _error;
+
+        public:
+            string_t get_error() const { return _error; }
+
+        protected:
+            void on_state_changed() {}
+            void on_stats_changed() {}
+            void on_limit_reached() {}
+
+            void on_thread_exception(const exception_t& exception)
+            {
+                // Only the first worker to fail reports it's error,
+                // since it stops all others.
+
+                if (_error == "")
+                {
+                    _error = exception.what();
+                }
+            }
+
+    }; /* error_listener */
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_frame(size_t size)
+    {
+        ethernet_frame_generator* ethernet = NULL;
+        ip_v4_frame_generator* ip_v4 = NULL;
+        udp_frame_generator* udp = NULL;
+
+        // All fields are fixed, so that the packet is rendered only
+        // once and the output alone decides how fast it goes.
+
+        ethernet = new ethernet_frame_generator(
+            false,
+            "02:00:00:00:00:01",
+            "02:00:00:00:00:02",
+            ethernet_frame_generator::TYPE_IP_V4);
+
+        ip_v4 = new ip_v4_frame_generator(
+            0, "0", 10, false, false, "0", 10, 64,
+            udp_frame_generator::IP_V4_PROTOCOL,
+            "10.0.0.1",
+            "10.0.0.2");
+
+        udp = new udp_frame_generator(
+            ip_v4->get_pseudo_header(), "1024", 10, "9", 10);
+
+        udp->get_payload()->adopt_generator(
+            new model::generators::string_generator(
+                string_t(size - HEADER_SIZE, 'x'),
+                model::generators::string_generator::encoding::ASCII));
+
+        ip_v4->get_payload()->adopt_generator(udp);
+        ethernet->get_payload()->adopt_generator(ip_v4);
+
+        return ethernet;
+
+    } /* create_frame */
+
+    /*---------------------------------------------------------------------- */
+
+    static device_t* find_device(const string_t& name)
+    {
+        vector_t<device_t*> devices;
+        device_t* result = NULL;
+
+        network_output_t::list_devices(devices);
+
+        for (auto device : devices)
+        {
+            if (result == NULL && device->get_name() == name)
+            {
+                result = device;
+            }
+            else
+            {
+                safe_delete(device);
+            }
+        }
+
+        assert::valid_argument(
+            result != NULL, "device", concat("unknown device: ", name));
+
+        return result;
+
+    } /* find_device */
+
+    /*---------------------------------------------------------------------- */
+
+    static duration_t get_cpu_time()
+    {
+        // User and system time of all threads of the process, which
+        // includes the time spent in the kernel sending the packets.
+
+        #ifdef OS_POSIX
+            rusage usage;
+
+            getrusage(RUSAGE_SELF, &usage);
+
+            return
+                std::chrono::seconds{ usage.ru_utime.tv_sec } +
+                std::chrono::microseconds{ usage.ru_utime.tv_usec } +
+                std::chrono::seconds{ usage.ru_stime.tv_sec } +
+                std::chrono::microseconds{ usage.ru_stime.tv_usec };
+        #else
+            return duration_t::zero();
+        #endif
+
+    } /* get_cpu_time */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_dispatcher(
+        bench_runner* runner,
+        const string_t& name,
+        data_output_t* output,
+        size_t frame_size,
+        size_t worker_count,
+        size_t batch_size)
+    {
+        data_generator_t* generator = NULL;
+        data_dispatcher_t::limits* limits = NULL;
+        data_dispatcher_t* dispatcher = NULL;
+        data_dispatcher_t::stats::snapshot stats = {};
+        error_listener listener;
+        bench_runner::result result = {};
+        duration_t cpu_time = duration_t::zero();
+        uint64_t allocations = 0;
+        double cpu_usage = 0;
+        size_t sent = 0;
+
+        try
+        {
+            generator = create_frame(frame_size);
+
+            limits = new data_dispatcher_t::limits(
+                data_dispatcher_t::limits::SIZE_UNLIMITED,
+                data_dispatcher_t::limits::SIZE_UNLIMITED,
+                runner->get_min_time());
+
+            dispatcher = new data_dispatcher_t(
+                output,
+                generator,
+                NULL,
+                limits,
+                worker_count,
+                batch_size);
+
+            dispatcher->add_listener(&listener);
+
+            allocations = allocation_counter::get_count();
+            cpu_time = get_cpu_time();
+
+            dispatcher->start(true);
+
+            while (!dispatcher->wait_for_stop(runner->get_min_time())) {}
+
+            cpu_time = get_cpu_time() - cpu_time;
+            allocations = allocation_counter::get_count() - allocations;
+            stats = dispatcher->get_stats()->get_snapshot();
+
+            // Workers are joined before the error is looked at
+
+            safe_delete(dispatcher);
+        }
+        catch (...)
+        {
+            safe_delete(dispatcher);
+            safe_delete(limits);
+            safe_delete(generator);
+
+            throw;
+        }
+
+        safe_delete(limits);
+        safe_delete(generator);
+
+        assert::legal_state(listener.get_error() == "", "", concat(
+            name, concat(": ", listener.get_error())));
+
+        // Packets the output failed to send are left out of the
+        // dispatcher's packet count, so it only holds those that made it.
+
+        sent = stats.packet_count;
+
+        assert::legal_state(
+            sent > 0, "", concat(name, ": no packets sent"));
+
+        cpu_usage =
+            std::chrono::duration<double>(cpu_time).count() /
+            std::chrono::duration<double>(stats.duration).count();
+
+        result.name = name;
+        result.iterations = sent;
+        result.duration = stats.duration;
+        result.allocations = allocations;
+        result.bytes_per_op = frame_size;
+        result.packets = true;
+
+        result.metrics.push_back({
+            "gbit_per_sec",
+            sent * frame_size * 8 /
+                std::chrono::duration<double>(stats.duration).count() /
+                1e9 });
+
+        result.metrics.push_back({
+            "send_failures", (double)stats.send_failure_count });
+
+        result.metrics.push_back({ "workers", (double)worker_count });
+        result.metrics.push_back({ "batch_size", (double)batch_size });
+
+        // CPU usage in percent of a single core, over all threads
+        // of the process and per worker (one core each at best).
+
+        result.metrics.push_back({ "cpu_usage", cpu_usage * 100 });
+
+        result.metrics.push_back({
+            "cpu_usage_per_worker", cpu_usage * 100 / worker_count });
+
+        runner->add(result);
+
+    } /* run_dispatcher */
+
+    /*---------------------------------------------------------------------- */
+
+    void run_dispatcher_benchmarks(
+        bench_runner* runner,
+        const string_t& device_name,
+        size_t worker_count,
+        size_t batch_size)
+    {
+        device_t* device = NULL;
+        data_output_t* output = NULL;
+        string_t name = "";
+
+        device = find_device(device_name);
+
+        try
+        {
+            for (auto frame_size : FRAME_SIZES)
+            {
+                // Network Output
+
+                name = concat(
+                    "dispatcher/network/",
+                    concat(device_name, "/" + std::to_string(frame_size)));
+
+                if (runner->is_selected(name))
+                {
+                    output = new network_output_t(device);
+
+                    run_dispatcher(
+                        runner,
+                        name,
+                        output,
+                        frame_size,
+                        worker_count,
+                        batch_size);
+
+                    safe_delete(output);
+                }
+
+                // TX Ring Output
+
+                name = concat(
+                    "dispatcher/packet_mmap/",
+                    concat(device_name, "/" + std::to_string(frame_size)));
+
+                if (packet_mmap_output_t::is_supported() &&
+                    runner->is_selected(name))
+                {
+                    // Ring frames are sized from the device MTU, the
+                    // same way as for the console and headless runs.
+
+                    output = new packet_mmap_output_t(device);
+
+                    run_dispatcher(
+                        runner,
+                        name,
+                        output,
+                        frame_size,
+                        worker_count,
+                        batch_size);
+
+                    safe_delete(output);
+                }
+            }
+        }
+        catch (...)
+        {
+            safe_delete(output);
+            safe_delete(device);
+
+            throw;
+        }
+
+        safe_delete(device);
+
+    } /* run_dispatcher_benchmarks */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
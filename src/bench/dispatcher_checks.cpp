@@ -0,0 +1,357 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/bench/benchmarks.h"
+#include "../../include/model/data_dispatcher.h"
+#include "../../include/model/packet_template.h"
+#include "../../include/model/random_engine.h"
+#include "../../include/model/generators/integer_generator.h"
+#include "../../include/model/generators/string_generator.h"
+#include "../../include/model/generators/protocols/ethernet_frame_generator.h"
+#include "../../include/model/generators/protocols/ip_v4_frame_generator.h"
+#include "../../include/model/generators/protocols/udp_frame_generator.h"
+
+#include <cstring>
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    using namespace model::generators::protocols;
+
+    using data_generator_t = model::data_generator;
+    using data_output_t = model::data_output;
+    using data_dispatcher_t = model::data_dispatcher;
+    using limits_t = data_dispatcher_t::limits;
+    using packet_template_t = model::packet_template;
+    using integer_generator_t = model::generators::integer_generator;
+
+    /*---------------------------------------------------------------------- */
+
+    static const size_t WORKER_COUNT = 4;
+    static const size_t PRIOR_PACKET_COUNT = 5;
+    static const size_t PACKET_COUNT = 256;
+    static const size_t CHECK_SEED = 42;
+
+    /*---------------------------------------------------------------------- */
+
+    class capture_output :
+        public data_output_t
+    {
+        private:
+            vector_t<vector_t<byte_t>> _packets;
+            mutable vector_t<capture_output*> _clones;
+
+        public:
+            const vector_t<vector_t<byte_t>>& get_packets() const
+            {
+                return _packets;
+            }
+
+            const vector_t<capture_output*>& get_clones() const
+            {
+                return _clones;
+            }
+
+            void open() {}
+            void close() noexcept {}
+
+            void send(byte_t* data, size_t size)
+            {
+                _packets.push_back(vector_t<byte_t>(data, data + size));
+            }
+
+            data_output_t* clone() const
+            {
+                // Clones are listed in the order of the workers using them
+
+                _clones.push_back(new capture_output());
+
+                return _clones.back();
+            }
+
+    }; /* capture_output */
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_frame(bool random = false)
+    {
+        ethernet_frame_generator* ethernet = NULL;
+        ip_v4_frame_generator* ip_v4 = NULL;
+        udp_frame_generator* udp = NULL;
+
+        // The destination address wraps around at 255,
+        // which has to be stepped over by every worker.
+
+        ethernet = new ethernet_frame_generator(
+            false,
+            random ? address_generator::RAND_MAC_PATTERN : "02:00:00:00:00:01",
+            "02:00:00:00:00:02",
+            ethernet_frame_generator::TYPE_IP_V4);
+
+        ip_v4 = new ip_v4_frame_generator(
+            0, random ? "*****" : "0", 10, false, false, "0", 10, 64,
+            udp_frame_generator::IP_V4_PROTOCOL,
+            random ? "10.0.*.*" : "10.0.0.1",
+            "10.0.0.+++");
+
+        udp = new udp_frame_generator(
+            ip_v4->get_pseudo_header(),
+            random ? "1****" : "1024", 10,
+            "9", 10);
+
+        udp->get_payload()->adopt_generator(
+            new model::generators::string_generator(
+                "Hyenae NG check payload",
+                model::generators::string_generator::encoding::ASCII));
+
+        ip_v4->get_payload()->adopt_generator(udp);
+        ethernet->get_payload()->adopt_generator(ip_v4);
+
+        return ethernet;
+
+    } /* create_frame */
+
+    /*---------------------------------------------------------------------- */
+
+    static void dispatch(
+        data_output_t* output,
+        data_generator_t* generator,
+        size_t worker_count,
+        size_t packet_count,
+        func_t<void()> action)
+    {
+        limits_t limits(
+            limits_t::SIZE_UNLIMITED,
+            packet_count,
+            limits_t::DURATION_UNLIMITED);
+
+        data_dispatcher_t dispatcher(
+            output, generator, NULL, &limits, worker_count);
+
+        // Short runs may be over before a wait for them to start would
+        // notice, so only their end is waited for.
+
+        dispatcher.start();
+
+        while (!dispatcher.wait_for_stop(std::chrono::milliseconds{ 100 }))
+        {
+        }
+
+        // Clones of the output only live as long as the dispatcher
+
+        action();
+
+    } /* dispatch */
+
+    /*---------------------------------------------------------------------- */
+
+    static void check_worker_sequences()
+    {
+        data_generator_t* generator = NULL;
+        capture_output prior_output;
+        capture_output output;
+        vector_t<vector_t<byte_t>> sequence;
+        const vector_t<vector_t<byte_t>>* packets = NULL;
+        size_t total = 0;
+
+        // The single worker sequence, which the workers together have to
+        // send with every value once, each worker taking every n-th value.
+
+        generator = create_frame();
+
+        for (size_t i = 0; i < PACKET_COUNT * WORKER_COUNT; i++)
+        {
+            sequence.push_back(vector_t<byte_t>(generator->size()));
+            generator->to_buffer(sequence.back().data(), generator->size());
+            generator->next();
+        }
+
+        safe_delete(generator);
+
+        // A previous run (e.g. from the console) leaves the generator
+        // somewhere in the middle of its sequence.
+
+        generator = create_frame();
+
+        dispatch(&prior_output, generator, 1, PRIOR_PACKET_COUNT, []() {});
+
+        dispatch(&output, generator, WORKER_COUNT, PACKET_COUNT, [&]()
+        {
+            for (size_t worker = 0; worker < WORKER_COUNT; worker++)
+            {
+                packets = worker == 0 ?
+                    &output.get_packets() :
+                    &output.get_clones()[worker - 1]->get_packets();
+
+                for (size_t i = 0; i < packets->size(); i++)
+                {
+                    assert::legal_state(
+                        (*packets)[i] ==
+                            sequence[worker + (i * WORKER_COUNT)],
+                        "",
+                        concat(
+                            "check/dispatcher/worker_sequences: worker ",
+                            std::to_string(worker) +
+                                " sent packet " + std::to_string(i) +
+                                " out of sequence"));
+                }
+
+                total += packets->size();
+            }
+        });
+
+        safe_delete(generator);
+
+        assert::legal_state(
+            total == PACKET_COUNT,
+            "",
+            "check/dispatcher/worker_sequences: wrong packet count");
+
+    } /* check_worker_sequences */
+
+    /*---------------------------------------------------------------------- */
+
+    static void check_template_batches(size_t step)
+    {
+        data_generator_t* reference = NULL;
+        data_generator_t* generator = NULL;
+        packet_template_t* packet = NULL;
+        vector_t<byte_t> buffer;
+        size_t packet_count = (packet_template_t::BATCH_COUNT * 3) + 5;
+
+        // Fields rendered a batch ahead have to give the same packets as
+        // the generator rendered as a whole, with equally seeded random
+        // wildcards and the workers' steps.
+
+        model::random_engine::set_default_seed(CHECK_SEED);
+        reference = create_frame(true);
+
+        model::random_engine::set_default_seed(CHECK_SEED);
+        generator = create_frame(true);
+
+        packet = new packet_template_t(generator, step);
+        buffer.resize(reference->size());
+
+        for (size_t i = 0; i < packet_count; i++)
+        {
+            reference->to_buffer(buffer.data(), buffer.size());
+
+            assert::legal_state(
+                memcmp(packet->render(), buffer.data(), buffer.size()) == 0,
+                "",
+                concat(
+                    "check/template/batches: packet ",
+                    std::to_string(i) + " differs at step " +
+                        std::to_string(step)));
+
+            reference->next(true, step);
+            packet->next();
+        }
+
+        safe_delete(packet);
+        safe_delete(generator);
+        safe_delete(reference);
+
+    } /* check_template_batches */
+
+    /*---------------------------------------------------------------------- */
+
+    static void check_integer_batches()
+    {
+        integer_generator_t* reference = NULL;
+        integer_generator_t* generator = NULL;
+        vector_t<byte_t> column;
+        uint32_t value = 0;
+
+        // A generator reset in the middle of a batch has to go on from
+        // where the values taken so far have left its random engine.
+
+        reference = integer_generator_t::create_uint32(
+            "1*+*+", integer_generator_t::BASE_DECIMAL);
+
+        generator = integer_generator_t::create_uint32(
+            "1*+*+", integer_generator_t::BASE_DECIMAL);
+
+        reference->set_seed(CHECK_SEED);
+        generator->set_seed(CHECK_SEED);
+
+        column.resize(generator->size() * packet_template_t::BATCH_COUNT);
+
+        generator->render_batch(
+            column.data(), generator->size(), packet_template_t::BATCH_COUNT);
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            value = reference->get_uint32();
+
+            assert::legal_state(
+                generator->get_uint32() == value &&
+                    memcmp(
+                        column.data() + (i * generator->size()),
+                        &value,
+                        generator->size()) == 0,
+                "",
+                "check/integer/batches: value out of sequence");
+
+            reference->next();
+            generator->next();
+        }
+
+        reference->reset();
+        generator->reset();
+
+        for (size_t i = 0; i < packet_template_t::BATCH_COUNT; i++)
+        {
+            assert::legal_state(
+                generator->get_uint32() == reference->get_uint32(),
+                "",
+                "check/integer/batches: value out of sequence after reset");
+
+            reference->next();
+            generator->next();
+        }
+
+        safe_delete(generator);
+        safe_delete(reference);
+
+    } /* check_integer_batches */
+
+    /*---------------------------------------------------------------------- */
+
+    void run_dispatcher_checks()
+    {
+        check_worker_sequences();
+        check_template_batches(1);
+        check_template_batches(WORKER_COUNT);
+        check_integer_batches();
+
+    } /* run_dispatcher_checks */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
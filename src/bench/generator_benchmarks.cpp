@@ -0,0 +1,335 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/bench/benchmarks.h"
+#include "../../include/model/generator_group.h"
+#include "../../include/model/packet_template.h"
+#include "../../include/model/generators/string_generator.h"
+#include "../../include/model/generators/integer_generator.h"
+#include "../../include/model/generators/fixed_data_generator.h"
+#include "../../include/model/generators/protocols/address_generator.h"
+#include "../../include/model/generators/protocols/ethernet_frame_generator.h"
+#include "../../include/model/generators/protocols/arp_frame_generator.h"
+#include "../../include/model/generators/protocols/ip_v4_frame_generator.h"
+#include "../../include/model/generators/protocols/ip_v6_frame_generator.h"
+#include "../../include/model/generators/protocols/icmp_v4_frame_generator.h"
+#include "../../include/model/generators/protocols/icmp_v6_frame_generator.h"
+#include "../../include/model/generators/protocols/icmp_echo_payload_generator.h"
+#include "../../include/model/generators/protocols/tcp_frame_generator.h"
+#include "../../include/model/generators/protocols/udp_frame_generator.h"
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    using data_generator_t = model::data_generator;
+    using integer_generator_t = model::generators::integer_generator;
+    using address_generator_t =
+        model::generators::protocols::address_generator;
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_generator(
+        bench_runner* runner,
+        const string_t& name,
+        data_generator_t* generator)
+    {
+        vector_t<byte_t> buffer(generator->size());
+
+        // A generator is measured the way it is used without a packet
+        // template: advanced to its next value and rendered as a whole.
+
+        runner->run(name, buffer.size(), false, [generator, &buffer]()
+        {
+            generator->next();
+            generator->to_buffer(buffer.data(), buffer.size());
+        });
+
+        safe_delete(generator);
+
+    } /* run_generator */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_generator_batch(
+        bench_runner* runner,
+        const string_t& name,
+        data_generator_t* generator)
+    {
+        size_t count = model::packet_template::BATCH_COUNT;
+        vector_t<byte_t> buffer(generator->size() * count);
+
+        // The same generator the way packet templates use it: the values
+        // of a whole batch rendered at once, then taken by next(). This
+        // compares to run_generator() by its mbit_per_sec.
+
+        runner->run(name, buffer.size(), false, [generator, count, &buffer]()
+        {
+            generator->render_batch(buffer.data(), generator->size(), count);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                generator->next();
+            }
+        });
+
+        safe_delete(generator);
+
+    } /* run_generator_batch */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_base_generators(bench_runner* runner)
+    {
+        size_t digit_count = 0;
+        uint64_t digit_weight = 0;
+        string_t name = "";
+
+        // Every base with as many wildcards as fit into 32 bits (e.g. 32
+        // binary or 8 hexadecimal digits), so that the pattern compiler
+        // can be compared across all bases.
+
+        for (size_t base = integer_generator_t::BASE_MIN;
+             base <= integer_generator_t::BASE_MAX;
+             base++)
+        {
+            digit_count = 0;
+
+            for (digit_weight = 1;
+                 digit_weight <= UINT32_MAX / base;
+                 digit_weight *= base)
+            {
+                digit_count++;
+            }
+
+            name = "generator/integer/base_" + std::to_string(base);
+
+            run_generator(
+                runner,
+                name + "_incremental",
+                integer_generator_t::create_uint32(
+                    string_t(digit_count, '+'), base));
+
+            run_generator(
+                runner,
+                name + "_random",
+                integer_generator_t::create_uint32(
+                    string_t(digit_count, '*'), base));
+        }
+
+    } /* run_base_generators */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_value_generators(bench_runner* runner)
+    {
+        model::generator_group* group = NULL;
+
+        run_generator(
+            runner,
+            "generator/fixed_data/uint32",
+            new model::generators::fixed_data_generator((uint32_t)1234));
+
+        run_generator(
+            runner,
+            "generator/integer/uint16_constant",
+            integer_generator_t::create_uint16(
+                "1234", integer_generator_t::BASE_DECIMAL));
+
+        run_generator(
+            runner,
+            "generator/integer/uint16_random",
+            integer_generator_t::create_uint16(
+                "****", integer_generator_t::BASE_DECIMAL));
+
+        run_generator(
+            runner,
+            "generator/integer/uint16_incremental",
+            integer_generator_t::create_uint16(
+                "++++", integer_generator_t::BASE_DECIMAL));
+
+        run_generator(
+            runner,
+            "generator/integer/uint32_random",
+            integer_generator_t::create_uint32(
+                "*********", integer_generator_t::BASE_DECIMAL));
+
+        run_base_generators(runner);
+
+        run_generator(
+            runner,
+            "generator/string/ascii_64",
+            new model::generators::string_generator(
+                string_t(64, 'x'),
+                model::generators::string_generator::encoding::ASCII));
+
+        run_generator(
+            runner,
+            "generator/address/mac_random",
+            address_generator_t::create_mac_address());
+
+        run_generator(
+            runner,
+            "generator/address/ip_v4_random",
+            address_generator_t::create_ip_v4_address());
+
+        run_generator(
+            runner,
+            "generator/address/ip_v4_incremental",
+            address_generator_t::create_ip_v4_address("10.0.0.1++"));
+
+        run_generator(
+            runner,
+            "generator/address/ip_v6_random",
+            address_generator_t::create_ip_v6_address());
+
+        group = new model::generator_group();
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            group->adopt_generator(
+                integer_generator_t::create_uint16(
+                    "****", integer_generator_t::BASE_DECIMAL));
+        }
+
+        run_generator(runner, "generator/group/4x_uint16_random", group);
+
+        run_generator_batch(
+            runner,
+            "generator/integer/uint16_random/batch_64",
+            integer_generator_t::create_uint16(
+                "****", integer_generator_t::BASE_DECIMAL));
+
+        run_generator_batch(
+            runner,
+            "generator/integer/uint16_incremental/batch_64",
+            integer_generator_t::create_uint16(
+                "++++", integer_generator_t::BASE_DECIMAL));
+
+        run_generator_batch(
+            runner,
+            "generator/integer/uint32_random/batch_64",
+            integer_generator_t::create_uint32(
+                "*********", integer_generator_t::BASE_DECIMAL));
+
+        run_generator_batch(
+            runner,
+            "generator/address/mac_random/batch_64",
+            address_generator_t::create_mac_address());
+
+        run_generator_batch(
+            runner,
+            "generator/address/ip_v4_random/batch_64",
+            address_generator_t::create_ip_v4_address());
+
+        run_generator_batch(
+            runner,
+            "generator/address/ip_v6_random/batch_64",
+            address_generator_t::create_ip_v6_address());
+
+    } /* run_value_generators */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_protocol_generators(bench_runner* runner)
+    {
+        using namespace model::generators::protocols;
+
+        ip_v4_frame_generator* ip_v4 = NULL;
+        ip_v6_frame_generator* ip_v6 = NULL;
+
+        // Frames are measured with their default (mostly random) fields
+        // and without a payload. Those of the transport layer use the
+        // pseudo header of an IP frame.
+
+        ip_v4 = new ip_v4_frame_generator();
+        ip_v6 = new ip_v6_frame_generator();
+
+        run_generator(
+            runner,
+            "generator/ethernet_frame",
+            new ethernet_frame_generator());
+
+        run_generator(
+            runner,
+            "generator/ethernet_frame_fcs",
+            new ethernet_frame_generator(
+                false,
+                address_generator::RAND_MAC_PATTERN,
+                address_generator::RAND_MAC_PATTERN,
+                ethernet_frame_generator::TYPE_IP_V4,
+                true));
+
+        run_generator(
+            runner,
+            "generator/arp_frame",
+            arp_frame_generator::create_for_ip_v4_over_ethernet(
+                arp_frame_generator::OPERATION_REQUEST));
+
+        run_generator(
+            runner,
+            "generator/icmp_v4_frame",
+            new icmp_v4_frame_generator());
+
+        run_generator(
+            runner,
+            "generator/icmp_v6_frame",
+            new icmp_v6_frame_generator(ip_v6->get_pseudo_header()));
+
+        run_generator(
+            runner,
+            "generator/icmp_echo_payload",
+            new icmp_echo_payload_generator());
+
+        run_generator(
+            runner,
+            "generator/tcp_frame",
+            new tcp_frame_generator(ip_v4->get_pseudo_header()));
+
+        run_generator(
+            runner,
+            "generator/udp_frame",
+            new udp_frame_generator(ip_v4->get_pseudo_header()));
+
+        // IP frames last, since their pseudo headers were used above
+
+        run_generator(runner, "generator/ip_v4_frame", ip_v4);
+        run_generator(runner, "generator/ip_v6_frame", ip_v6);
+
+    } /* run_protocol_generators */
+
+    /*---------------------------------------------------------------------- */
+
+    void run_generator_benchmarks(bench_runner* runner)
+    {
+        run_value_generators(runner);
+        run_protocol_generators(runner);
+
+    } /* run_generator_benchmarks */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
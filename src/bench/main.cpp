@@ -0,0 +1,157 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/common.h"
+#include "../../include/bench/benchmarks.h"
+#include "../../include/bench/bench_runner.h"
+
+#include <cstdio>
+
+/*---------------------------------------------------------------------- */
+
+int main(int argc, char** argv)
+{
+    using exception_t = hyenae::exception_t;
+    using string_t = hyenae::string_t;
+    using bench_runner_t = hyenae::bench::bench_runner;
+
+    string_t arg = "";
+    string_t filter = "";
+    string_t label = "";
+    string_t device = "";
+    int64_t min_time_ms = 200;
+    size_t worker_count = 1;
+    size_t batch_size = 1;
+    bench_runner_t* runner = NULL;
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            arg = argv[i];
+
+            if (arg == "--filter" && i + 1 < argc)
+            {
+                filter = argv[++i];
+            }
+            else if (arg == "--time" && i + 1 < argc)
+            {
+                min_time_ms = std::stoll(argv[++i]);
+            }
+            else if (arg == "--label" && i + 1 < argc)
+            {
+                label = argv[++i];
+            }
+            else if (arg == "--device" && i + 1 < argc)
+            {
+                device = argv[++i];
+            }
+            else if (arg == "--workers" && i + 1 < argc)
+            {
+                worker_count = std::stoul(argv[++i]);
+            }
+            else if (arg == "--batch" && i + 1 < argc)
+            {
+                batch_size = std::stoul(argv[++i]);
+            }
+            else
+            {
+                fprintf(
+                    stderr,
+                    "Usage: %s [--filter <text>] [--time <ms>] "
+                    "[--label <text>]\n"
+                    "          [--device <name> [--workers <n>] "
+                    "[--batch <n>]]\n",
+                    argv[0]);
+
+                return -1;
+            }
+        }
+
+        runner = new bench_runner_t(
+            filter, std::chrono::milliseconds{ min_time_ms });
+
+        // Benchmarks of a dispatcher that doesn't send what it should
+        // are worthless, so its results are checked before any timing.
+
+        hyenae::bench::run_dispatcher_checks();
+
+        hyenae::bench::run_generator_benchmarks(runner);
+        hyenae::bench::run_transformation_benchmarks(runner);
+        hyenae::bench::run_stack_benchmarks(runner);
+
+        // Sending to a real device takes root privileges, which is why
+        // the dispatcher only runs against a device if one is given.
+
+        if (device != "")
+        {
+            hyenae::bench::run_dispatcher_benchmarks(
+                runner, device, worker_count, batch_size);
+        }
+
+        // Results go to stdout as JSON (e.g. to be compared with those
+        // of another commit), a readable summary goes to stderr.
+
+        for (size_t i = 0; i < runner->result_count(); i++)
+        {
+            const bench_runner_t::result& result = runner->result_at(i);
+
+            fprintf(
+                stderr,
+                "%-48s %12.1f ns/op %8.2f allocs/op",
+                result.name.c_str(),
+                (double)std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(result.duration).count() /
+                        result.iterations,
+                (double)result.allocations / result.iterations);
+
+            for (auto& metric : result.metrics)
+            {
+                fprintf(
+                    stderr, " %s=%.2f", metric.name.c_str(), metric.value);
+            }
+
+            fprintf(stderr, "\n");
+        }
+
+        fprintf(stdout, "%s", runner->to_json(label).c_str());
+
+        hyenae::safe_delete(runner);
+    }
+    catch (const exception_t& exception)
+    {
+        fprintf(stderr, "Error: %s\n", exception.what());
+
+        hyenae::safe_delete(runner);
+
+        return -1;
+    }
+
+    return 0;
+
+} /* main */
+
+/*---------------------------------------------------------------------- */
@@ -0,0 +1,288 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/bench/benchmarks.h"
+#include "../../include/model/packet_template.h"
+#include "../../include/model/outputs/no_output.h"
+#include "../../include/model/generators/string_generator.h"
+#include "../../include/model/generators/protocols/ethernet_frame_generator.h"
+#include "../../include/model/generators/protocols/arp_frame_generator.h"
+#include "../../include/model/generators/protocols/ip_v4_frame_generator.h"
+#include "../../include/model/generators/protocols/ip_v6_frame_generator.h"
+#include "../../include/model/generators/protocols/icmp_v4_frame_generator.h"
+#include "../../include/model/generators/protocols/icmp_v6_frame_generator.h"
+#include "../../include/model/generators/protocols/icmp_echo_payload_generator.h"
+#include "../../include/model/generators/protocols/tcp_frame_generator.h"
+#include "../../include/model/generators/protocols/udp_frame_generator.h"
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    using namespace model::generators::protocols;
+
+    using data_generator_t = model::data_generator;
+    using data_output_t = model::data_output;
+
+    /*---------------------------------------------------------------------- */
+
+    static const char* PAYLOAD_TEXT = "Hyenae NG benchmark payload";
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_text()
+    {
+        return new model::generators::string_generator(
+            PAYLOAD_TEXT,
+            model::generators::string_generator::encoding::ASCII);
+
+    } /* create_text */
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_transport(
+        const string_t& transport, data_generator_t* pseudo_header)
+    {
+        data_generator_t* generator = NULL;
+
+        if (transport == "tcp")
+        {
+            generator = new tcp_frame_generator(pseudo_header);
+
+            ((tcp_frame_generator*)generator)->get_payload()->
+                adopt_generator(create_text());
+        }
+        else
+        {
+            generator = new udp_frame_generator(pseudo_header);
+
+            ((udp_frame_generator*)generator)->get_payload()->
+                adopt_generator(create_text());
+        }
+
+        return generator;
+
+    } /* create_transport */
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_ip_v4_stack(const string_t& transport)
+    {
+        ethernet_frame_generator* ethernet = NULL;
+        ip_v4_frame_generator* ip_v4 = NULL;
+        icmp_v4_frame_generator* icmp_v4 = NULL;
+
+        ethernet = new ethernet_frame_generator(
+            false,
+            address_generator::RAND_MAC_PATTERN,
+            address_generator::RAND_MAC_PATTERN,
+            ethernet_frame_generator::TYPE_IP_V4);
+
+        if (transport == "icmp")
+        {
+            ip_v4 = new ip_v4_frame_generator(
+                0, "*****", 10, false, false, "0", 10, 128,
+                icmp_v4_frame_generator::IP_V4_PROTOCOL);
+
+            icmp_v4 = new icmp_v4_frame_generator(
+                icmp_echo_payload_generator::ICMP_V4_TYPE,
+                icmp_echo_payload_generator::ICMP_V4_CODE);
+
+            icmp_v4->get_payload()->adopt_generator(
+                new icmp_echo_payload_generator());
+
+            ip_v4->get_payload()->adopt_generator(icmp_v4);
+        }
+        else
+        {
+            ip_v4 = new ip_v4_frame_generator(
+                0, "*****", 10, false, false, "0", 10, 128,
+                transport == "tcp" ?
+                    tcp_frame_generator::IP_V4_PROTOCOL :
+                    udp_frame_generator::IP_V4_PROTOCOL);
+
+            ip_v4->get_payload()->adopt_generator(
+                create_transport(transport, ip_v4->get_pseudo_header()));
+        }
+
+        ethernet->get_payload()->adopt_generator(ip_v4);
+
+        return ethernet;
+
+    } /* create_ip_v4_stack */
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_ip_v6_stack(const string_t& transport)
+    {
+        ethernet_frame_generator* ethernet = NULL;
+        ip_v6_frame_generator* ip_v6 = NULL;
+        icmp_v6_frame_generator* icmp_v6 = NULL;
+
+        ethernet = new ethernet_frame_generator(
+            false,
+            address_generator::RAND_MAC_PATTERN,
+            address_generator::RAND_MAC_PATTERN,
+            ethernet_frame_generator::TYPE_IP_V6);
+
+        if (transport == "icmp")
+        {
+            ip_v6 = new ip_v6_frame_generator(
+                0, "*****", 10, icmp_v6_frame_generator::IP_V6_PROTOCOL);
+
+            icmp_v6 = new icmp_v6_frame_generator(
+                ip_v6->get_pseudo_header(),
+                icmp_echo_payload_generator::ICMP_V6_TYPE,
+                icmp_echo_payload_generator::ICMP_V6_CODE);
+
+            icmp_v6->get_payload()->adopt_generator(
+                new icmp_echo_payload_generator());
+
+            ip_v6->get_payload()->adopt_generator(icmp_v6);
+        }
+        else
+        {
+            ip_v6 = new ip_v6_frame_generator(
+                0, "*****", 10,
+                transport == "tcp" ?
+                    tcp_frame_generator::IP_V6_NEXT_HEADER :
+                    udp_frame_generator::IP_V6_NEXT_HEADER);
+
+            ip_v6->get_payload()->adopt_generator(
+                create_transport(transport, ip_v6->get_pseudo_header()));
+        }
+
+        ethernet->get_payload()->adopt_generator(ip_v6);
+
+        return ethernet;
+
+    } /* create_ip_v6_stack */
+
+    /*---------------------------------------------------------------------- */
+
+    static data_generator_t* create_arp_stack()
+    {
+        ethernet_frame_generator* ethernet = NULL;
+
+        ethernet = new ethernet_frame_generator(
+            false,
+            address_generator::RAND_MAC_PATTERN,
+            address_generator::RAND_MAC_PATTERN,
+            ethernet_frame_generator::TYPE_ARP);
+
+        ethernet->get_payload()->adopt_generator(
+            arp_frame_generator::create_for_ip_v4_over_ethernet(
+                arp_frame_generator::OPERATION_REQUEST));
+
+        return ethernet;
+
+    } /* create_arp_stack */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_stack(
+        bench_runner* runner,
+        const string_t& name,
+        data_generator_t* generator)
+    {
+        data_output_t* output = new model::outputs::no_output();
+        model::packet_template* packet = NULL;
+        vector_t<byte_t> buffer;
+
+        output->open();
+
+        // Rendered from a packet template, like the dispatcher does
+
+        packet = new model::packet_template(generator);
+
+        runner->run(
+            concat(name, "/template"),
+            packet->size(),
+            true,
+            [output, packet]()
+        {
+            output->send(packet->render(), packet->size());
+            packet->next();
+        });
+
+        // Rendered as a whole, for comparison
+
+        buffer.resize(generator->size());
+
+        runner->run(
+            concat(name, "/to_buffer"),
+            buffer.size(),
+            true,
+            [generator, output, &buffer]()
+        {
+            output->send(
+                generator->to_buffer(buffer.data(), buffer.size()),
+                buffer.size());
+
+            generator->next();
+        });
+
+        output->close();
+
+        safe_delete(packet);
+        safe_delete(output);
+        safe_delete(generator);
+
+    } /* run_stack */
+
+    /*---------------------------------------------------------------------- */
+
+    void run_stack_benchmarks(bench_runner* runner)
+    {
+        run_stack(
+            runner, "stack/ethernet_ip_v4_tcp", create_ip_v4_stack("tcp"));
+
+        run_stack(
+            runner, "stack/ethernet_ip_v4_udp", create_ip_v4_stack("udp"));
+
+        run_stack(
+            runner,
+            "stack/ethernet_ip_v4_icmp_echo",
+            create_ip_v4_stack("icmp"));
+
+        run_stack(
+            runner, "stack/ethernet_ip_v6_tcp", create_ip_v6_stack("tcp"));
+
+        run_stack(
+            runner, "stack/ethernet_ip_v6_udp", create_ip_v6_stack("udp"));
+
+        run_stack(
+            runner,
+            "stack/ethernet_ip_v6_icmp_echo",
+            create_ip_v6_stack("icmp"));
+
+        run_stack(runner, "stack/ethernet_arp", create_arp_stack());
+
+    } /* run_stack_benchmarks */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
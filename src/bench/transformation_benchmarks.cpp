@@ -0,0 +1,169 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/bench/benchmarks.h"
+#include "../../include/model/random_engine.h"
+#include "../../include/model/data_transformation/to_crc32_checksum.h"
+#include "../../include/model/data_transformation/to_internet_checksum.h"
+#include "../../include/model/data_transformation/to_network_order.h"
+#include "../../include/model/data_transformation/to_reverse_order.h"
+#include "../../include/model/data_transformation/to_tcp_udp_checksum.h"
+
+namespace hyenae::bench
+{
+    /*---------------------------------------------------------------------- */
+
+    using data_transformation_t = model::data_transformation;
+
+    /*---------------------------------------------------------------------- */
+
+    static vector_t<byte_t> create_data(size_t size)
+    {
+        vector_t<byte_t> data(size);
+        model::random_engine random(size);
+
+        for (auto& value : data)
+        {
+            value = (byte_t)random.next(256);
+        }
+
+        return data;
+
+    } /* create_data */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_transformation(
+        bench_runner* runner,
+        const string_t& name,
+        const data_transformation_t* transformation,
+        size_t size)
+    {
+        vector_t<byte_t> data = create_data(size);
+        vector_t<byte_t> result(transformation->result_size(size));
+
+        runner->run(
+            concat(name, "/" + std::to_string(size)),
+            size,
+            false,
+            [transformation, &data, &result]()
+        {
+            transformation->transform(
+                data.data(), data.size(), result.data());
+        });
+
+    } /* run_transformation */
+
+    /*---------------------------------------------------------------------- */
+
+    static void run_incremental_update(
+        bench_runner* runner,
+        const string_t& name,
+        const data_transformation_t* transformation,
+        size_t size)
+    {
+        vector_t<byte_t> data = create_data(size);
+        vector_t<byte_t> field = create_data(sizeof(uint32_t));
+        vector_t<byte_t> result(transformation->result_size(size));
+
+        // Measures updating the result for a changed 4 byte field, as
+        // done for every packet rendered from a packet template.
+
+        transformation->transform(data.data(), data.size(), result.data());
+
+        runner->run(
+            concat(name, "/" + std::to_string(size)),
+            size,
+            false,
+            [transformation, &data, &field, &result]()
+        {
+            transformation->update(
+                result.data(),
+                data.data(),
+                field.data(),
+                field.size(),
+                0);
+
+            std::swap_ranges(field.begin(), field.end(), data.begin());
+        });
+
+    } /* run_incremental_update */
+
+    /*---------------------------------------------------------------------- */
+
+    void run_transformation_benchmarks(bench_runner* runner)
+    {
+        using namespace model::data_transformations;
+
+        to_crc32_checksum* crc32 =
+            new to_crc32_checksum(to_crc32_checksum::POLYNOMIAL_ETHERNET);
+
+        for (size_t size : { 64, 1500 })
+        {
+            run_transformation(
+                runner, "transformation/crc32_checksum", crc32, size);
+
+            run_transformation(
+                runner,
+                "transformation/internet_checksum",
+                to_internet_checksum::get_instance(),
+                size);
+
+            run_transformation(
+                runner,
+                "transformation/tcp_udp_checksum",
+                to_tcp_udp_checksum::get_instance(),
+                size);
+
+            run_incremental_update(
+                runner,
+                "transformation/internet_checksum_update",
+                to_internet_checksum::get_instance(),
+                size);
+        }
+
+        for (size_t size : { 2, 4, 8 })
+        {
+            run_transformation(
+                runner,
+                "transformation/network_order",
+                to_network_order::get_instance(),
+                size);
+
+            run_transformation(
+                runner,
+                "transformation/reverse_order",
+                to_reverse_order::get_instance(),
+                size);
+        }
+
+        safe_delete(crc32);
+
+    } /* run_transformation_benchmarks */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::bench */
@@ -62,7 +62,7 @@ namespace hyenae
         string_t tmp = "";
         string_t item_name = "";
         string_t item_value = "";
-        size_t section_index = 0;
+        section* root_section = NULL;
         section* cur_section = NULL;
         vector_t<section*> sections;
 
@@ -84,6 +84,7 @@ namespace hyenae
                     if (cur_section == NULL)
                     {
                         cur_section = new section(trim(item_name));
+                        root_section = cur_section;
                     }
                     else
                     {
@@ -91,9 +92,10 @@ namespace hyenae
                             cur_section->add_sub_section(trim(item_name));
                     }
 
-                    sections.push_back(cur_section);
+                    // Open sections are kept as a stack, so that closing
+                    // one returns to its parent, even after siblings.
 
-                    section_index = sections.size();
+                    sections.push_back(cur_section);
 
                     item_name = "";
                 }
@@ -137,9 +139,9 @@ namespace hyenae
                 {
                     // Current section closed
 
-                    if (section_index > 0)
+                    if (sections.size() > 0)
                     {
-                        section_index--;
+                        sections.pop_back();
                     }
                     else
                     {
@@ -147,7 +149,10 @@ namespace hyenae
                             false, "", "unexpected end of section");
                     }
 
-                    cur_section = sections[section_index];
+                    if (sections.size() > 0)
+                    {
+                        cur_section = sections.back();
+                    }
                 }
                 else
                 {
@@ -163,7 +168,7 @@ namespace hyenae
                 }
             }
 
-            if (section_index != 0)
+            if (sections.size() != 0)
             {
                 assert::valid_format(
                     false, "", "unclosed section");
@@ -171,18 +176,15 @@ namespace hyenae
         }
         catch (const exception_t& exception)
         {
-            if (sections.size() > 0)
-            {
-                // It is only required to delete the root section since all
-                // sub-sections will be delete by it's destructor.
+            // It is only required to delete the root section since all
+            // sub-sections will be delete by it's destructor.
 
-                safe_delete(sections.front());
-            }
+            safe_delete(root_section);
             
             throw runtime_error_t(exception.what());
         }
         
-        return new config(cur_section);
+        return new config(root_section);
 
     } /* parse */
 
@@ -28,6 +28,7 @@
 #include "../../../include/frontend/console/console_app.h"
 #include "../../../include/frontend/console/io/std_console_io.h"
 #include "../../../include/frontend/console/console_app_config.h"
+#include "../../../include/frontend/headless/headless_app.h"
 
 
 /*---------------------------------------------------------------------- */
@@ -44,6 +45,15 @@ int main(int argc, char** argv)
         hyenae::frontend::console::io::std_console_io;
 
     using console_app_t = hyenae::frontend::console::console_app;
+
+    using headless_app_t = hyenae::frontend::headless::headless_app;
+
+    // Scripted runs don't need the menu, nor its configuration file
+
+    if (headless_app_t::is_requested(argc, argv))
+    {
+        return headless_app_t(std_file_io_t::PROVIDER).run(argc, argv);
+    }
     
     console_app_config_t config(std_file_io_t::PROVIDER);
     std_console_io_t console_io(&config);
@@ -160,6 +160,71 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t arp_frame_setup::get_scenario_type() const
+    {
+        return "arp";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void arp_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_string(
+            section,
+            "operation",
+            _operation == arp_frame_generator_t::OPERATION_REQUEST ?
+                "request" : "reply");
+
+        scenario_t::set_string(
+            section, "sender_mac", _sender_hw_addr_pattern);
+
+        scenario_t::set_string(
+            section, "sender_ip", _sender_proto_addr_pattern);
+
+        scenario_t::set_string(
+            section, "target_mac", _target_hw_addr_pattern);
+
+        scenario_t::set_string(
+            section, "target_ip", _target_proto_addr_pattern);
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void arp_frame_setup::load_scenario(section_t* section)
+    {
+        string_t operation = scenario_t::get_string(
+            section,
+            "operation",
+            _operation == arp_frame_generator_t::OPERATION_REQUEST ?
+                "request" : "reply");
+
+        assert::valid_format(
+            operation == "request" || operation == "reply",
+            "operation",
+            "expected request or reply");
+
+        _operation = operation == "request" ?
+            arp_frame_generator_t::OPERATION_REQUEST :
+            arp_frame_generator_t::OPERATION_REPLY;
+
+        _sender_hw_addr_pattern = scenario_t::get_string(
+            section, "sender_mac", _sender_hw_addr_pattern);
+
+        _sender_proto_addr_pattern = scenario_t::get_string(
+            section, "sender_ip", _sender_proto_addr_pattern);
+
+        _target_hw_addr_pattern = scenario_t::get_string(
+            section, "target_mac", _target_hw_addr_pattern);
+
+        _target_proto_addr_pattern = scenario_t::get_string(
+            section, "target_ip", _target_proto_addr_pattern);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void arp_frame_setup::on_select()
     {
         _ethernet_frame_setup->set_type(
@@ -46,6 +46,25 @@ namespace hyenae::frontend::console::states
         // Default delay
         _delay_type = delay_type::NONE;
         _delay = NULL;
+        _pacer = NULL;
+
+        // Default worker count
+        _worker_count = 1;
+
+        // Default batch size
+        _batch_size = 1;
+
+        // Default wait policy
+        _wait_policy = wait_policy_t::HYBRID;
+
+        // Default ring depth
+        _ring_depth = data_dispatcher_t::RING_DISABLED;
+
+        // Default cache size
+        _cache_size = data_dispatcher_t::CACHE_DISABLED;
+
+        // Default stats interval
+        _stats_interval = data_dispatcher_t::DEFAULT_STATS_INTERVAL;
 
         _menu = new console_menu(console_io, "Dispatcher Setup", this, parent);
 
@@ -64,6 +83,30 @@ namespace hyenae::frontend::console::states
         // Send-Delay
         _send_delay_item = new console_menu::item("Send-Delay");
         _menu->add_item(_send_delay_item);
+
+        // Worker Threads
+        _worker_count_item = new console_menu::item("Worker Threads");
+        _menu->add_item(_worker_count_item);
+
+        // Batch Size
+        _batch_size_item = new console_menu::item("Batch Size");
+        _menu->add_item(_batch_size_item);
+
+        // Wait Policy
+        _wait_policy_item = new console_menu::item("Wait Policy");
+        _menu->add_item(_wait_policy_item);
+
+        // Ring Depth
+        _ring_depth_item = new console_menu::item("Ring Depth");
+        _menu->add_item(_ring_depth_item);
+
+        // Packet Cache
+        _cache_size_item = new console_menu::item("Packet Cache");
+        _menu->add_item(_cache_size_item);
+
+        // Stats Interval
+        _stats_interval_item = new console_menu::item("Stats Interval");
+        _menu->add_item(_stats_interval_item);
     }
 
     /*---------------------------------------------------------------------- */
@@ -75,8 +118,15 @@ namespace hyenae::frontend::console::states
         safe_delete(_packet_limit_item);
         safe_delete(_duration_limit_item);
         safe_delete(_send_delay_item);
+        safe_delete(_worker_count_item);
+        safe_delete(_batch_size_item);
+        safe_delete(_wait_policy_item);
+        safe_delete(_ring_depth_item);
+        safe_delete(_cache_size_item);
+        safe_delete(_stats_interval_item);
         safe_delete(_limits);
         safe_delete(_delay);
+        safe_delete(_pacer);
 
     } /* ~dispatcher_setup */
 
@@ -106,6 +156,30 @@ namespace hyenae::frontend::console::states
         {
             prompt_send_delay();
         }
+        else if (choice == _worker_count_item)
+        {
+            prompt_worker_count();
+        }
+        else if (choice == _batch_size_item)
+        {
+            prompt_batch_size();
+        }
+        else if (choice == _wait_policy_item)
+        {
+            prompt_wait_policy();
+        }
+        else if (choice == _ring_depth_item)
+        {
+            prompt_ring_depth();
+        }
+        else if (choice == _cache_size_item)
+        {
+            prompt_cache_size();
+        }
+        else if (choice == _stats_interval_item)
+        {
+            prompt_stats_interval();
+        }
 
         return true;
 
@@ -129,6 +203,253 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    dispatcher_setup::pacer_t* dispatcher_setup::get_pacer()
+    {
+        return _pacer;
+
+    } /* get_pacer */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t dispatcher_setup::get_worker_count() const
+    {
+        return _worker_count;
+
+    } /* get_worker_count */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t dispatcher_setup::get_batch_size() const
+    {
+        return _batch_size;
+
+    } /* get_batch_size */
+
+    /*---------------------------------------------------------------------- */
+
+    dispatcher_setup::wait_policy_t dispatcher_setup::get_wait_policy() const
+    {
+        return _wait_policy;
+
+    } /* get_wait_policy */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t dispatcher_setup::get_ring_depth() const
+    {
+        return _ring_depth;
+
+    } /* get_ring_depth */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t dispatcher_setup::get_cache_size() const
+    {
+        return _cache_size;
+
+    } /* get_cache_size */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t dispatcher_setup::get_stats_interval() const
+    {
+        return _stats_interval;
+
+    } /* get_stats_interval */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_number(
+            section, "byte_limit", _limits->get_byte_limit());
+
+        scenario_t::set_number(
+            section, "packet_limit", _limits->get_packet_limit());
+
+        scenario_t::set_number(
+            section,
+            "duration_limit",
+            (uint64_t)to_ms(_limits->get_duration_limit()));
+
+        scenario_t::set_number(section, "workers", _worker_count);
+        scenario_t::set_number(section, "batch_size", _batch_size);
+
+        switch (_wait_policy)
+        {
+            case wait_policy_t::BUSY_POLL:
+                scenario_t::set_string(section, "wait_policy", "busy_poll");
+                break;
+
+            case wait_policy_t::SLEEP:
+                scenario_t::set_string(section, "wait_policy", "sleep");
+                break;
+
+            default:
+                scenario_t::set_string(section, "wait_policy", "hybrid");
+        }
+
+        scenario_t::set_number(section, "ring_depth", _ring_depth);
+        scenario_t::set_number(section, "cache_size", _cache_size / 1024);
+
+        scenario_t::set_number(
+            section, "stats_interval", (uint64_t)to_ms(_stats_interval));
+
+        switch (_delay_type)
+        {
+            case delay_type::FIXED:
+                scenario_t::set_string(section, "delay", "fixed");
+
+                scenario_t::set_number(
+                    section,
+                    "delay_duration",
+                    (uint64_t)to_ms(((fixed_delay_t*)_delay)->get_duration()));
+
+                break;
+
+            case delay_type::RANDOM:
+                scenario_t::set_string(section, "delay", "random");
+
+                scenario_t::set_number(
+                    section,
+                    "delay_min",
+                    (uint64_t)to_ms(
+                        ((random_delay_t*)_delay)->get_min_duration()));
+
+                scenario_t::set_number(
+                    section,
+                    "delay_max",
+                    (uint64_t)to_ms(
+                        ((random_delay_t*)_delay)->get_max_duration()));
+
+                break;
+
+            case delay_type::RATE:
+                scenario_t::set_string(section, "delay", "rate");
+
+                scenario_t::set_number(
+                    section, "packet_rate", _pacer->get_packet_rate());
+
+                scenario_t::set_number(
+                    section, "bit_rate", _pacer->get_bit_rate() / 1000);
+
+                scenario_t::set_number(
+                    section, "burst_size", _pacer->get_burst_size());
+
+                break;
+
+            default:
+                scenario_t::set_string(section, "delay", "none");
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::load_scenario(section_t* section)
+    {
+        string_t wait_policy_name = "";
+        limits_t* limits = NULL;
+        size_t worker_count = 0;
+        size_t batch_size = 0;
+        wait_policy_t wait_policy = _wait_policy;
+        size_t ring_depth = 0;
+        size_t cache_size = 0;
+        duration_t stats_interval = duration_t{ 0 };
+
+        // Everything is parsed and checked before any of it is applied,
+        // so that a malformed section leaves the setup as it was.
+
+        worker_count = scenario_t::get_number(
+            section, "workers", _worker_count, MAX_WORKER_COUNT);
+
+        batch_size = scenario_t::get_number(
+            section, "batch_size", _batch_size, MAX_BATCH_SIZE);
+
+        assert::valid_format(worker_count > 0, "workers", "expected > 0");
+        assert::valid_format(batch_size > 0, "batch_size", "expected > 0");
+
+        wait_policy_name = scenario_t::get_string(section, "wait_policy", "");
+
+        if (wait_policy_name == "busy_poll")
+        {
+            wait_policy = wait_policy_t::BUSY_POLL;
+        }
+        else if (wait_policy_name == "hybrid")
+        {
+            wait_policy = wait_policy_t::HYBRID;
+        }
+        else if (wait_policy_name == "sleep")
+        {
+            wait_policy = wait_policy_t::SLEEP;
+        }
+        else
+        {
+            assert::valid_format(
+                wait_policy_name == "",
+                "wait_policy",
+                "expected busy_poll, hybrid or sleep");
+        }
+
+        ring_depth = scenario_t::get_number(
+            section, "ring_depth", _ring_depth, MAX_RING_DEPTH);
+
+        cache_size = scenario_t::get_number(
+            section, "cache_size", _cache_size / 1024, MAX_CACHE_SIZE) * 1024;
+
+        stats_interval = std::chrono::milliseconds{ scenario_t::get_number(
+            section,
+            "stats_interval",
+            (uint64_t)to_ms(_stats_interval),
+            MAX_STATS_INTERVAL) };
+
+        assert::in_range(
+            stats_interval > duration_t{ 0 }, "stats_interval");
+
+        limits = new limits_t(
+            scenario_t::get_number(
+                section,
+                "byte_limit",
+                _limits->get_byte_limit(),
+                INT32_MAX),
+            scenario_t::get_number(
+                section,
+                "packet_limit",
+                _limits->get_packet_limit(),
+                INT32_MAX),
+            std::chrono::milliseconds{ scenario_t::get_number(
+                section,
+                "duration_limit",
+                to_ms(_limits->get_duration_limit()),
+                INT64_MAX) });
+
+        try
+        {
+            // Only applies the delay once it has been accepted
+
+            load_delay(section);
+        }
+        catch (const exception_t&)
+        {
+            safe_delete(limits);
+
+            throw;
+        }
+
+        safe_delete(_limits);
+
+        _limits = limits;
+        _worker_count = worker_count;
+        _batch_size = batch_size;
+        _wait_policy = wait_policy;
+        _ring_depth = ring_depth;
+        _cache_size = cache_size;
+        _stats_interval = stats_interval;
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void dispatcher_setup::update_menu_items()
     {
         string_t delay_info = "";
@@ -188,16 +509,137 @@ namespace hyenae::frontend::console::states
                         ((random_delay_t*)_delay)->get_max_duration()));
                 break;
 
+            case delay_type::RATE:
+                if (_pacer->get_packet_rate() != pacer_t::RATE_UNLIMITED)
+                {
+                    delay_info.append(
+                        std::to_string(_pacer->get_packet_rate()));
+                    delay_info.append(" pps");
+                }
+
+                if (_pacer->get_bit_rate() != pacer_t::RATE_UNLIMITED)
+                {
+                    if (!delay_info.empty())
+                    {
+                        delay_info.append(", ");
+                    }
+
+                    delay_info.append(
+                        std::to_string(_pacer->get_bit_rate() / 1000));
+                    delay_info.append(" kbit/s");
+                }
+                break;
+
             default:
                 assert::legal_call(false, "", "unknown delay type");
         }
 
         _send_delay_item->set_info(delay_info);
 
+        // Worker Threads
+        _worker_count_item->set_info(std::to_string(_worker_count));
+
+        // Batch Size
+        _batch_size_item->set_info(
+            _batch_size > 1 ? std::to_string(_batch_size) : "Off");
+
+        // Wait Policy
+        switch (_wait_policy)
+        {
+            case wait_policy_t::BUSY_POLL:
+                _wait_policy_item->set_info("Busy-Poll");
+                break;
+
+            case wait_policy_t::HYBRID:
+                _wait_policy_item->set_info("Hybrid");
+                break;
+
+            case wait_policy_t::SLEEP:
+                _wait_policy_item->set_info("Sleep");
+                break;
+
+            default:
+                assert::legal_call(false, "", "unknown wait policy");
+        }
+
+        // Ring Depth
+        _ring_depth_item->set_info(
+            _ring_depth > 0 ? std::to_string(_ring_depth) : "Off");
+
+        // Packet Cache
+        _cache_size_item->set_info(
+            _cache_size > 0 ?
+                std::to_string(_cache_size / 1024).append(" KB") : "Off");
+
+        // Stats Interval
+        _stats_interval_item->set_info(to_ms_string(_stats_interval));
+
     } /* update_menu_items */
 
     /*---------------------------------------------------------------------- */
 
+    void dispatcher_setup::load_delay(section_t* section)
+    {
+        string_t type = scenario_t::get_string(section, "delay", "");
+        delay_type new_type = delay_type::NONE;
+        delay_t* delay = NULL;
+        pacer_t* pacer = NULL;
+
+        // Without a delay type, the current delay is kept
+
+        if (type == "")
+        {
+            return;
+        }
+
+        if (type == "fixed")
+        {
+            new_type = delay_type::FIXED;
+            delay = new fixed_delay_t(
+                std::chrono::milliseconds{ scenario_t::get_number(
+                    section, "delay_duration", 0, INT64_MAX) });
+        }
+        else if (type == "random")
+        {
+            new_type = delay_type::RANDOM;
+            delay = new random_delay_t(
+                std::chrono::milliseconds{ scenario_t::get_number(
+                    section, "delay_min", 0, INT64_MAX) },
+                std::chrono::milliseconds{ scenario_t::get_number(
+                    section, "delay_max", 0, INT64_MAX) });
+        }
+        else if (type == "rate")
+        {
+            new_type = delay_type::RATE;
+            pacer = new pacer_t(
+                scenario_t::get_number(
+                    section, "packet_rate", pacer_t::RATE_UNLIMITED),
+                scenario_t::get_number(
+                    section,
+                    "bit_rate",
+                    pacer_t::RATE_UNLIMITED,
+                    UINT64_MAX / 1000) * 1000,
+                scenario_t::get_number(section, "burst_size", 1, INT32_MAX));
+        }
+        else
+        {
+            assert::valid_format(
+                type == "none",
+                "delay",
+                "expected none, fixed, random or rate");
+        }
+
+        safe_delete(_delay);
+        safe_delete(_pacer);
+
+        _delay_type = new_type;
+        _delay = delay;
+        _pacer = pacer;
+
+    } /* load_delay */
+
+    /*---------------------------------------------------------------------- */
+
     void dispatcher_setup::prompt_byte_limit()
     {
         int64_t input = 0;
@@ -290,11 +732,17 @@ namespace hyenae::frontend::console::states
         int64_t input = 0;
 
         input = get_console()->prompt(
-            0, 2, "Enter Delay Type", "0 = Off, 1 = Fixed, 2 = Random");
+            0,
+            3,
+            "Enter Delay Type",
+            "0 = Off, 1 = Fixed, 2 = Random, 3 = Rate");
 
         switch (input)
         {
             case 0:
+                safe_delete(_delay);
+                safe_delete(_pacer);
+
                 _delay_type = delay_type::NONE;
                 break;
 
@@ -306,6 +754,10 @@ namespace hyenae::frontend::console::states
                 prompt_random_send_delay();
                 break;
 
+            case 3:
+                prompt_rate_send_delay();
+                break;
+
             default:
                 assert::legal_state(false, "", "Unknown delay type selected");
         }
@@ -322,6 +774,7 @@ namespace hyenae::frontend::console::states
             0, INT64_MAX, "Enter delay duration (ms)");
 
         safe_delete(_delay);
+        safe_delete(_pacer);
 
         _delay_type = delay_type::FIXED;
         _delay = new fixed_delay_t(
@@ -338,6 +791,7 @@ namespace hyenae::frontend::console::states
         bool success = false;
 
         safe_delete(_delay);
+        safe_delete(_pacer);
 
         while (!success)
         {
@@ -366,4 +820,124 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    void dispatcher_setup::prompt_rate_send_delay()
+    {
+        int64_t packet_rate = 0;
+        int64_t bit_rate = 0;
+        int64_t burst_size = 0;
+        bool success = false;
+
+        safe_delete(_delay);
+        safe_delete(_pacer);
+
+        while (!success)
+        {
+            try
+            {
+                packet_rate = get_console()->prompt(
+                    0, INT64_MAX, "Enter packet rate (pps)", "0 = Off");
+
+                bit_rate = get_console()->prompt(
+                    0, INT64_MAX / 1000, "Enter bit rate (kbit/s)", "0 = Off");
+
+                burst_size = get_console()->prompt(
+                    1, INT32_MAX, "Enter burst size (packets)");
+
+                _delay_type = delay_type::RATE;
+                _pacer = new pacer_t(
+                    (uint64_t)packet_rate,
+                    (uint64_t)bit_rate * 1000,
+                    (size_t)burst_size);
+
+                success = true;
+            }
+            catch (const std::out_of_range&)
+            {
+                get_console()->error_out("Invalid rate: No rate set");
+            }
+        }
+
+    } /* prompt_rate_send_delay */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::prompt_worker_count()
+    {
+        _worker_count = (size_t)get_console()->prompt(
+            1, MAX_WORKER_COUNT, "Enter Worker Threads");
+
+    } /* prompt_worker_count */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::prompt_batch_size()
+    {
+        _batch_size = (size_t)get_console()->prompt(
+            1, MAX_BATCH_SIZE, "Enter Batch Size", "1 = Off");
+
+    } /* prompt_batch_size */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::prompt_wait_policy()
+    {
+        int64_t input = 0;
+
+        input = get_console()->prompt(
+            0,
+            2,
+            "Enter Wait Policy",
+            "0 = Busy-Poll, 1 = Hybrid, 2 = Sleep");
+
+        switch (input)
+        {
+            case 0:
+                _wait_policy = wait_policy_t::BUSY_POLL;
+                break;
+
+            case 1:
+                _wait_policy = wait_policy_t::HYBRID;
+                break;
+
+            case 2:
+                _wait_policy = wait_policy_t::SLEEP;
+                break;
+
+            default:
+                assert::legal_state(false, "", "Unknown wait policy selected");
+        }
+
+    } /* prompt_wait_policy */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::prompt_ring_depth()
+    {
+        _ring_depth = (size_t)get_console()->prompt(
+            0, MAX_RING_DEPTH, "Enter Ring Depth", "0 = Off");
+
+    } /* prompt_ring_depth */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::prompt_cache_size()
+    {
+        _cache_size = (size_t)get_console()->prompt(
+            0, MAX_CACHE_SIZE, "Enter Packet Cache Size (KB)", "0 = Off");
+
+        _cache_size *= 1024;
+
+    } /* prompt_cache_size */
+
+    /*---------------------------------------------------------------------- */
+
+    void dispatcher_setup::prompt_stats_interval()
+    {
+        _stats_interval = std::chrono::milliseconds{ get_console()->prompt(
+            1, MAX_STATS_INTERVAL, "Enter Stats Interval (ms)", "") };
+
+    } /* prompt_stats_interval */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::frontend::console::states */
@@ -177,6 +177,56 @@ namespace hyenae::frontend::console::states
 
     } /* update_generator */
 
+    /*---------------------------------------------------------------------- */
+
+    string_t ethernet_frame_setup::get_scenario_type() const
+    {
+        return "ethernet";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void ethernet_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_switch(section, "preamble_sfd", _add_preamble_sfd);
+        scenario_t::set_string(section, "src_mac", _src_mac_pattern);
+        scenario_t::set_string(section, "dst_mac", _dst_mac_pattern);
+        scenario_t::set_number(section, "ether_type", _type);
+        scenario_t::set_switch(section, "fcs", _add_fcs);
+
+        if (_payload->get_generator() != NULL)
+        {
+            _payload->save_scenario(
+                section->add_sub_section(scenario_t::SECTION_PAYLOAD));
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void ethernet_frame_setup::load_scenario(section_t* section)
+    {
+        _payload->load_scenario(
+            scenario_t::find_sub_section(
+                section, scenario_t::SECTION_PAYLOAD));
+
+        _add_preamble_sfd = scenario_t::get_switch(
+            section, "preamble_sfd", _add_preamble_sfd);
+
+        _src_mac_pattern = scenario_t::get_string(
+            section, "src_mac", _src_mac_pattern);
+
+        _dst_mac_pattern = scenario_t::get_string(
+            section, "dst_mac", _dst_mac_pattern);
+
+        _type = (uint16_t)scenario_t::get_number(
+            section, "ether_type", _type, UINT16_MAX);
+
+        _add_fcs = scenario_t::get_switch(section, "fcs", _add_fcs);
+
+    } /* load_scenario */
+
     /*---------------------------------------------------------------------- */
     
     void ethernet_frame_setup::update_menu_items()
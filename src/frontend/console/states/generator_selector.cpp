@@ -24,6 +24,7 @@
  *
  */
 
+#include "../../../../include/assert.h"
 #include "../../../../include/frontend/console/states/generator_selector.h"
 #include "../../../../include/frontend/console/states/ethernet_frame_setup.h"
 #include "../../../../include/frontend/console/states/arp_frame_setup.h"
@@ -273,6 +274,80 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t generator_selector::get_scenario_type() const
+    {
+        if (_selected_setup != NULL)
+        {
+            return _selected_setup->get_scenario_type();
+        }
+        else
+        {
+            return "";
+        }
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void generator_selector::save_scenario(section_t* section) const
+    {
+        if (_selected_setup != NULL)
+        {
+            scenario_t::set_string(
+                section, "type", _selected_setup->get_scenario_type());
+
+            _selected_setup->save_scenario(section);
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void generator_selector::load_scenario(section_t* section)
+    {
+        string_t type = "";
+
+        if (!_init)
+        {
+            inizialize();
+
+            _init = true;
+        }
+
+        _selected_item = NULL;
+        _selected_setup = NULL;
+
+        // Without a section, no generator is selected at all
+
+        if (section != NULL)
+        {
+            type = scenario_t::get_string(section, "type");
+
+            for (auto item : _menu_items)
+            {
+                if (item.second->get_scenario_type() == type)
+                {
+                    _selected_item = item.first;
+                    _selected_setup = item.second;
+                }
+            }
+
+            assert::valid_format(
+                _selected_setup != NULL,
+                "type",
+                concat("unexpected generator type: ", type));
+
+            // Selecting a payload sets the fields of its parent that
+            // identify it, which may then still be overridden.
+
+            _selected_setup->on_select();
+            _selected_setup->load_scenario(section);
+        }
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void generator_selector::inizialize()
     {
         using namespace model::generators::protocols;
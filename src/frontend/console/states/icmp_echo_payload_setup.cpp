@@ -129,6 +129,35 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t icmp_echo_payload_setup::get_scenario_type() const
+    {
+        return "icmp_echo";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void icmp_echo_payload_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_string(section, "id", _id_pattern);
+        scenario_t::set_string(section, "seq_num", _seq_num_pattern);
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void icmp_echo_payload_setup::load_scenario(section_t* section)
+    {
+        _id_pattern = scenario_t::get_string(
+            section, "id", _id_pattern);
+
+        _seq_num_pattern = scenario_t::get_string(
+            section, "seq_num", _seq_num_pattern);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void icmp_echo_payload_setup::on_select()
     {
         _icmp_frame_setup->set_type(_type);
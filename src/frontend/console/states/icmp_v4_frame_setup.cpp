@@ -184,6 +184,45 @@ namespace hyenae::frontend::console::states
 
     } /* update_generator */
 
+    /*---------------------------------------------------------------------- */
+
+    string_t icmp_v4_frame_setup::get_scenario_type() const
+    {
+        return "icmp_v4";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void icmp_v4_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_number(section, "icmp_type", _type);
+        scenario_t::set_number(section, "code", _code);
+
+        if (_payload->get_generator() != NULL)
+        {
+            _payload->save_scenario(
+                section->add_sub_section(scenario_t::SECTION_PAYLOAD));
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void icmp_v4_frame_setup::load_scenario(section_t* section)
+    {
+        _payload->load_scenario(
+            scenario_t::find_sub_section(
+                section, scenario_t::SECTION_PAYLOAD));
+
+        _type = (uint8_t)scenario_t::get_number(
+            section, "icmp_type", _type, UINT8_MAX);
+
+        _code = (uint8_t)scenario_t::get_number(
+            section, "code", _code, UINT8_MAX);
+
+    } /* load_scenario */
+
    /*---------------------------------------------------------------------- */
 
     void icmp_v4_frame_setup::on_select()
@@ -238,6 +238,73 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t ip_v4_frame_setup::get_scenario_type() const
+    {
+        return "ip_v4";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void ip_v4_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_number(section, "tos", _type_of_service);
+        scenario_t::set_string(section, "id", _id_pattern);
+        scenario_t::set_switch(section, "dont_frag", _dont_frag);
+        scenario_t::set_switch(section, "more_frags", _more_frags);
+        scenario_t::set_string(section, "frag_offset", _frag_offset_pattern);
+        scenario_t::set_number(section, "ttl", _time_to_live);
+        scenario_t::set_number(section, "protocol", _protocol);
+        scenario_t::set_string(section, "src_ip", _src_ip_pattern);
+        scenario_t::set_string(section, "dst_ip", _dst_ip_pattern);
+
+        if (_payload->get_generator() != NULL)
+        {
+            _payload->save_scenario(
+                section->add_sub_section(scenario_t::SECTION_PAYLOAD));
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void ip_v4_frame_setup::load_scenario(section_t* section)
+    {
+        _payload->load_scenario(
+            scenario_t::find_sub_section(
+                section, scenario_t::SECTION_PAYLOAD));
+
+        _type_of_service = (uint8_t)scenario_t::get_number(
+            section, "tos", _type_of_service, UINT8_MAX);
+
+        _id_pattern = scenario_t::get_string(
+            section, "id", _id_pattern);
+
+        _dont_frag = scenario_t::get_switch(
+            section, "dont_frag", _dont_frag);
+
+        _more_frags = scenario_t::get_switch(
+            section, "more_frags", _more_frags);
+
+        _frag_offset_pattern = scenario_t::get_string(
+            section, "frag_offset", _frag_offset_pattern);
+
+        _time_to_live = (uint8_t)scenario_t::get_number(
+            section, "ttl", _time_to_live, UINT8_MAX);
+
+        _protocol = (uint8_t)scenario_t::get_number(
+            section, "protocol", _protocol, UINT8_MAX);
+
+        _src_ip_pattern = scenario_t::get_string(
+            section, "src_ip", _src_ip_pattern);
+
+        _dst_ip_pattern = scenario_t::get_string(
+            section, "dst_ip", _dst_ip_pattern);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void ip_v4_frame_setup::on_select()
     {
         get_ethernet_frame_setup()->set_type(
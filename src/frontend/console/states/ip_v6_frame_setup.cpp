@@ -207,6 +207,61 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t ip_v6_frame_setup::get_scenario_type() const
+    {
+        return "ip_v6";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void ip_v6_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_number(section, "traffic_class", _traffic_class);
+        scenario_t::set_string(section, "flow_label", _flow_label_pattern);
+        scenario_t::set_number(section, "next_header", _next_header);
+        scenario_t::set_number(section, "hop_limit", _hop_limit);
+        scenario_t::set_string(section, "src_ip", _src_ip_pattern);
+        scenario_t::set_string(section, "dst_ip", _dst_ip_pattern);
+
+        if (_payload->get_generator() != NULL)
+        {
+            _payload->save_scenario(
+                section->add_sub_section(scenario_t::SECTION_PAYLOAD));
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void ip_v6_frame_setup::load_scenario(section_t* section)
+    {
+        _payload->load_scenario(
+            scenario_t::find_sub_section(
+                section, scenario_t::SECTION_PAYLOAD));
+
+        _traffic_class = (uint8_t)scenario_t::get_number(
+            section, "traffic_class", _traffic_class, UINT8_MAX);
+
+        _flow_label_pattern = scenario_t::get_string(
+            section, "flow_label", _flow_label_pattern);
+
+        _next_header = (uint8_t)scenario_t::get_number(
+            section, "next_header", _next_header, UINT8_MAX);
+
+        _hop_limit = (uint8_t)scenario_t::get_number(
+            section, "hop_limit", _hop_limit, UINT8_MAX);
+
+        _src_ip_pattern = scenario_t::get_string(
+            section, "src_ip", _src_ip_pattern);
+
+        _dst_ip_pattern = scenario_t::get_string(
+            section, "dst_ip", _dst_ip_pattern);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void ip_v6_frame_setup::on_select()
     {
         get_ethernet_frame_setup()->set_type(
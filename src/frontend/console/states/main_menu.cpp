@@ -31,6 +31,10 @@ namespace hyenae::frontend::console::states
 {
     /*---------------------------------------------------------------------- */
 
+    const char* main_menu::SCENARIO_PATH = "./hyenae.scenario";
+
+    /*---------------------------------------------------------------------- */
+
     main_menu::main_menu(
         console_app_state_context* context,
         console_app_config* config,
@@ -38,6 +42,8 @@ namespace hyenae::frontend::console::states
         file_io::provider file_io_provider) :
             console_app_state(context, config, console_io)
     {
+        _file_io_provider = file_io_provider;
+        _scenario_path = SCENARIO_PATH;
         _menu = new console_menu(console_io, "Main Menu", this, NULL);
         
         // Output setup
@@ -58,6 +64,14 @@ namespace hyenae::frontend::console::states
         _dispatcher_setup_item = new console_menu::item("Dispatcher Setup");
         _menu->add_item(_dispatcher_setup_item);
 
+        // Save scenario
+        _save_scenario_item = new console_menu::item("Save Scenario");
+        _menu->add_item(_save_scenario_item);
+
+        // Load scenario
+        _load_scenario_item = new console_menu::item("Load Scenario");
+        _menu->add_item(_load_scenario_item);
+
         // Start dispatcher
         _start_dispatcher = new states::start_dispatcher(
             context,
@@ -81,6 +95,8 @@ namespace hyenae::frontend::console::states
         safe_delete(_output_setup_item);
         safe_delete(_generator_selector_item);
         safe_delete(_dispatcher_setup_item);
+        safe_delete(_save_scenario_item);
+        safe_delete(_load_scenario_item);
         safe_delete(_output_setup);
         safe_delete(_generator_selector);
         safe_delete(_dispatcher_setup);
@@ -106,6 +122,14 @@ namespace hyenae::frontend::console::states
         {
             _dispatcher_setup->enter();
         }
+        else if (choice == _save_scenario_item)
+        {
+            save_scenario();
+        }
+        else if (choice == _load_scenario_item)
+        {
+            load_scenario();
+        }
         else if (choice == _menu->get_parent_state_item())
         {
             return get_console()->prompt(
@@ -118,4 +142,97 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    void main_menu::save_scenario()
+    {
+        get_console()->header_out("Save Scenario");
+
+        _scenario_path = get_console()->prompt(
+            "Enter Path", _scenario_path, _scenario_path);
+
+        get_console()->task_out("Save", [this]()
+        {
+            config scenario(scenario_t::SECTION_ROOT);
+            config::section* root = scenario.get_root_section();
+
+            _output_setup->save_scenario(
+                root->add_sub_section(scenario_t::SECTION_OUTPUT));
+
+            if (_generator_selector->get_generator() != NULL)
+            {
+                _generator_selector->save_scenario(
+                    root->add_sub_section(scenario_t::SECTION_GENERATOR));
+            }
+
+            _dispatcher_setup->save_scenario(
+                root->add_sub_section(scenario_t::SECTION_DISPATCHER));
+
+            scenario_t::save(_file_io_provider, _scenario_path, &scenario);
+
+            return true;
+        });
+
+        get_console()->separator_out(true, false);
+
+        get_console()->wait_for_key_press();
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void main_menu::load_scenario()
+    {
+        get_console()->header_out("Load Scenario");
+
+        _scenario_path = get_console()->prompt(
+            "Enter Path", _scenario_path, _scenario_path);
+
+        get_console()->task_out("Load", [this]()
+        {
+            config* scenario = NULL;
+            config::section* root = NULL;
+
+            try
+            {
+                scenario = scenario_t::load(_file_io_provider, _scenario_path);
+                root = scenario->get_root_section();
+
+                // Nothing is applied to the setup states until every
+                // section has been accepted.
+
+                scenario_t::validate(root, _file_io_provider);
+
+                _output_setup->load_scenario(
+                    root->get_or_create_sub_section(
+                        scenario_t::SECTION_OUTPUT));
+
+                _generator_selector->load_scenario(
+                    scenario_t::find_sub_section(
+                        root, scenario_t::SECTION_GENERATOR));
+
+                _dispatcher_setup->load_scenario(
+                    root->get_or_create_sub_section(
+                        scenario_t::SECTION_DISPATCHER));
+
+                _generator_selector->update_generator();
+            }
+            catch (const exception_t&)
+            {
+                safe_delete(scenario);
+
+                throw;
+            }
+
+            safe_delete(scenario);
+
+            return true;
+        });
+
+        get_console()->separator_out(true, false);
+
+        get_console()->wait_for_key_press();
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::frontend::console::states */
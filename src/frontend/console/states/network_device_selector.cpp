@@ -104,6 +104,31 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    void network_device_selector::select_device(const string_t& name)
+    {
+        console_menu::item* choice = NULL;
+
+        for (auto menu_item : _menu_items)
+        {
+            if (menu_item.second->get_name() == name)
+            {
+                choice = menu_item.first;
+            }
+        }
+
+        assert::valid_argument(
+            choice != NULL, "device", concat("unknown device: ", name));
+
+        _menu->select_all(false);
+        choice->set_selected(true);
+
+        _device = _menu_items[choice];
+        _selected_item = choice;
+
+    } /* select_device */
+
+    /*---------------------------------------------------------------------- */
+
     console_menu::item* network_device_selector::add_device(device_t* device)
     {
         console_menu::item* menu_item = NULL;
@@ -27,6 +27,7 @@
 #include "../../../../include/assert.h"
 #include "../../../../include/model/outputs/no_output.h"
 #include "../../../../include/model/outputs/file_output.h"
+#include "../../../../include/model/outputs/packet_mmap_output.h"
 #include "../../../../include/frontend/console/states/output_setup.h"
 
 namespace hyenae::frontend::console::states
@@ -34,6 +35,7 @@ namespace hyenae::frontend::console::states
     /*---------------------------------------------------------------------- */
 
     const char* output_setup::FILE_OUTPUT_PATH = "./hyenae.dump";
+    const char* output_setup::CAPTURE_FILE_OUTPUT_PATH = "./hyenae.pcap";
 
     /*---------------------------------------------------------------------- */
 
@@ -52,13 +54,20 @@ namespace hyenae::frontend::console::states
 
         // Default values
         _file_path = FILE_OUTPUT_PATH;
+        _capture_file_path = CAPTURE_FILE_OUTPUT_PATH;
+        _capture_file_format = capture_format_t::PCAP;
+        _capture_file_nanoseconds = false;
         
         // No Output
-        add_output("No Output", new model::outputs::no_output());
+        _no_output_item =
+            add_output("No Output", new model::outputs::no_output());
 
         // Send To File
         _file_output_item = add_output("File System", NULL);
 
+        // Send To Capture File
+        _capture_file_output_item = add_output("Capture File", NULL);
+
         // Send To Network
         try
         {
@@ -68,6 +77,12 @@ namespace hyenae::frontend::console::states
                 context, config, console_io, this);
 
             _network_output_item = add_output("Network Adapter", NULL);
+
+            if (model::outputs::packet_mmap_output::is_supported())
+            {
+                _packet_mmap_output_item =
+                    add_output("Network Adapter (TX Ring)", NULL);
+            }
         }
         catch (const exception_t& exception)
         {
@@ -109,16 +124,7 @@ namespace hyenae::frontend::console::states
             choice != _menu->get_parent_state_item() &&
             choice != NULL)
         {
-            _menu->select_all(false);
-
-            _file_output_item->set_hint("");
-
-            if (_network_output_item != NULL)
-            {
-                _network_output_item->set_hint("");
-            }
-
-            choice->set_selected(true);
+            select_item(choice);
 
             output = _menu_items[choice];
 
@@ -128,14 +134,26 @@ namespace hyenae::frontend::console::states
 
                 _output = select_file_output(_selected_item == choice);
             }
-            else if (choice == _network_output_item)
+            else if (choice == _capture_file_output_item)
             {
-                _network_output_item->set_hint("...");
+                _capture_file_output_item->set_hint("...");
 
-                if (_selected_item == _network_output_item)
+                _output = select_capture_file_output(
+                    _selected_item == choice);
+            }
+            else if (choice == _network_output_item ||
+                     choice == _packet_mmap_output_item)
+            {
+                choice->set_hint("...");
+
+                if (_selected_item == choice)
                 {
                     _network_device_selector->enter();
                 }
+                else
+                {
+                    _output = output;
+                }
             }
             else
             {
@@ -159,15 +177,149 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    void output_setup::save_scenario(section_t* section) const
+    {
+        if (_selected_item == _file_output_item)
+        {
+            scenario_t::set_string(section, "type", "file");
+            scenario_t::set_string(section, "path", _file_path);
+        }
+        else if (_selected_item == _capture_file_output_item)
+        {
+            scenario_t::set_string(section, "type", "capture_file");
+            scenario_t::set_string(section, "path", _capture_file_path);
+
+            scenario_t::set_string(
+                section,
+                "format",
+                _capture_file_format == capture_format_t::PCAP ?
+                    "pcap" : "pcapng");
+
+            scenario_t::set_switch(
+                section, "nanoseconds", _capture_file_nanoseconds);
+        }
+        else if (_selected_item != NULL &&
+                 _selected_item != _no_output_item)
+        {
+            scenario_t::set_string(
+                section,
+                "type",
+                _selected_item == _network_output_item ?
+                    "network" : "packet_mmap");
+
+            scenario_t::set_string(
+                section,
+                "device",
+                _network_device_selector->get_device()->get_name());
+        }
+        else
+        {
+            scenario_t::set_string(section, "type", "none");
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void output_setup::load_scenario(section_t* section)
+    {
+        string_t type = scenario_t::get_string(section, "type", "none");
+        string_t format = "";
+        console_menu::item* choice = NULL;
+
+        if (type == "none")
+        {
+            choice = _no_output_item;
+        }
+        else if (type == "file")
+        {
+            choice = _file_output_item;
+
+            _file_path = scenario_t::get_string(section, "path", _file_path);
+        }
+        else if (type == "capture_file")
+        {
+            choice = _capture_file_output_item;
+
+            _capture_file_path = scenario_t::get_string(
+                section, "path", _capture_file_path);
+
+            format = scenario_t::get_string(section, "format", "pcap");
+
+            assert::valid_format(
+                format == "pcap" || format == "pcapng",
+                "format",
+                "expected pcap or pcapng");
+
+            _capture_file_format = format == "pcap" ?
+                capture_format_t::PCAP : capture_format_t::PCAPNG;
+
+            _capture_file_nanoseconds = scenario_t::get_switch(
+                section, "nanoseconds", _capture_file_nanoseconds);
+        }
+        else if (type == "network" || type == "packet_mmap")
+        {
+            choice = type == "network" ?
+                _network_output_item : _packet_mmap_output_item;
+
+            assert::legal_state(
+                choice != NULL, "", concat(type, " output not available"));
+
+            _network_device_selector->select_device(
+                scenario_t::get_string(section, "device"));
+        }
+        else
+        {
+            assert::valid_format(false, "type", "unknown output type");
+        }
+
+        select_item(choice);
+
+        _selected_item = choice;
+
+        if (choice == _file_output_item)
+        {
+            choice->set_hint("...");
+
+            _output = select_file_output(false);
+        }
+        else if (choice == _capture_file_output_item)
+        {
+            choice->set_hint("...");
+
+            _output = select_capture_file_output(false);
+        }
+        else if (choice != _no_output_item)
+        {
+            choice->set_hint("...");
+
+            update_network_output();
+        }
+        else
+        {
+            _output = _menu_items[choice];
+        }
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void output_setup::update_menu_items()
     {
         _file_output_item->set_info(_file_path);
+        _capture_file_output_item->set_info(_capture_file_path);
 
         if (_network_output_item != NULL)
         {
             _network_output_item->set_info(
                 _network_device_selector->get_device()->get_description());
         }
+
+        if (_packet_mmap_output_item != NULL)
+        {
+            _packet_mmap_output_item->set_info(
+                _network_device_selector->get_device()->get_description());
+        }
         
     } /* update_menu_items */
 
@@ -185,12 +337,49 @@ namespace hyenae::frontend::console::states
             {
                 _output = _menu_items[_network_output_item];
             }
+
+            if (_packet_mmap_output_item != NULL)
+            {
+                safe_delete(_menu_items[_packet_mmap_output_item]);
+
+                _menu_items[_packet_mmap_output_item] =
+                    new model::outputs::packet_mmap_output(
+                        _network_device_selector->get_device());
+
+                if (_selected_item == _packet_mmap_output_item)
+                {
+                    _output = _menu_items[_packet_mmap_output_item];
+                }
+            }
         }
         
     } /* update_network_output */
 
     /*---------------------------------------------------------------------- */
 
+    void output_setup::select_item(console_menu::item* item)
+    {
+        _menu->select_all(false);
+
+        _file_output_item->set_hint("");
+        _capture_file_output_item->set_hint("");
+
+        if (_network_output_item != NULL)
+        {
+            _network_output_item->set_hint("");
+        }
+
+        if (_packet_mmap_output_item != NULL)
+        {
+            _packet_mmap_output_item->set_hint("");
+        }
+
+        item->set_selected(true);
+
+    } /* select_item */
+
+    /*---------------------------------------------------------------------- */
+
     console_menu::item* output_setup::add_output(
         string_t caption, data_output_t* output)
     {
@@ -234,4 +423,34 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    output_setup::data_output_t* output_setup::select_capture_file_output(
+        bool setup)
+    {
+        safe_delete(_menu_items[_capture_file_output_item]);
+
+        if (setup)
+        {
+            _capture_file_path = get_console()->prompt(
+                "Enter Path", _capture_file_path, _capture_file_path);
+
+            _capture_file_format = (capture_format_t)get_console()->prompt(
+                0, 1, "Enter File Format", "0 = pcap, 1 = pcapng");
+
+            _capture_file_nanoseconds = get_console()->prompt(
+                0, 1, "Enable Nanosecond Timestamps", "0 = Off, 1 = On");
+        }
+
+        _menu_items[_capture_file_output_item] =
+            new model::outputs::capture_file_output(
+                _file_io_provider,
+                _capture_file_path,
+                _capture_file_format,
+                _capture_file_nanoseconds);
+
+        return _menu_items[_capture_file_output_item];
+
+    } /* select_capture_file_output */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::frontend::console::states */
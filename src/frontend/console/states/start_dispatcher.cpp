@@ -84,7 +84,14 @@ namespace hyenae::frontend::console::states
 
     void start_dispatcher::on_thread_exception(const exception_t& exception)
     {
-        _thread_exception = new exception_t(exception);
+        // Only the first thread to fail reports it's error, since it
+        // stops all others. A copy of the base class would lose the
+        // message.
+
+        if (_thread_exception == NULL)
+        {
+            _thread_exception = new runtime_error_t(exception.what());
+        }
 
     } /* on_thread_exception */
 
@@ -108,7 +115,14 @@ namespace hyenae::frontend::console::states
                 _output_setup->get_output(),
                 _generator_setup->get_generator(),
                 _dispatcher_setup->get_delay(),
-                _dispatcher_setup->get_limits());
+                _dispatcher_setup->get_limits(),
+                _dispatcher_setup->get_worker_count(),
+                _dispatcher_setup->get_batch_size(),
+                _dispatcher_setup->get_pacer(),
+                _dispatcher_setup->get_wait_policy(),
+                _dispatcher_setup->get_ring_depth(),
+                _dispatcher_setup->get_cache_size(),
+                _dispatcher_setup->get_stats_interval());
 
             _dispatcher->add_listener(this);
 
@@ -150,7 +164,10 @@ namespace hyenae::frontend::console::states
 
             get_console()->prompt_out("", "Press any key to stop");
 
-            while (_dispatcher->is_running())
+            // Keys are only checked every now and then, so that this
+            // thread doesn't take a core away from the workers.
+
+            while (!_dispatcher->wait_for_stop(KEY_POLL_INTERVAL))
             {
                 if (get_console()->was_key_pressed())
                 {
@@ -180,22 +197,44 @@ namespace hyenae::frontend::console::states
 
     void start_dispatcher::result_screen()
     {
+        data_dispatcher_t::stats::snapshot stats =
+            _dispatcher->get_stats()->get_snapshot();
+
         get_console()->header_out("Results");
 
         // Bytes
         get_console()->result_out(
-            "Bytes",
-            std::to_string(_dispatcher->get_stats()->get_byte_count()));
+            "Bytes", std::to_string(stats.byte_count));
 
         // Pckets
         get_console()->result_out(
-            "Packets",
-            std::to_string(_dispatcher->get_stats()->get_packet_count()));
+            "Packets", std::to_string(stats.packet_count));
 
         // Duration
         get_console()->result_out(
-            "Duration",
-            to_ms_string(_dispatcher->get_stats()->get_duration()));
+            "Duration", to_ms_string(stats.duration));
+
+        // Send Failures
+        get_console()->result_out(
+            "Send Failures", std::to_string(stats.send_failure_count));
+
+        if (_dispatcher->get_cache_size() != data_dispatcher_t::CACHE_DISABLED)
+        {
+            // Cached Packets
+            get_console()->result_out(
+                "Cached Packets", std::to_string(stats.cached_packet_count));
+        }
+
+        if (_dispatcher->get_ring_depth() != data_dispatcher_t::RING_DISABLED)
+        {
+            // Ring Full
+            get_console()->result_out(
+                "Ring Full", std::to_string(stats.ring_full_count));
+
+            // Ring Empty
+            get_console()->result_out(
+                "Ring Empty", std::to_string(stats.ring_empty_count));
+        }
 
         // Error
         if (_thread_exception != NULL)
@@ -238,6 +238,36 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    void tcp_flags_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_switch(section, "cwr", _cwr_flag);
+        scenario_t::set_switch(section, "ece", _ece_flag);
+        scenario_t::set_switch(section, "urg", _urg_flag);
+        scenario_t::set_switch(section, "ack", _ack_flag);
+        scenario_t::set_switch(section, "psh", _psh_flag);
+        scenario_t::set_switch(section, "rst", _rst_flag);
+        scenario_t::set_switch(section, "syn", _syn_flag);
+        scenario_t::set_switch(section, "fin", _fin_flag);
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void tcp_flags_setup::load_scenario(section_t* section)
+    {
+        _cwr_flag = scenario_t::get_switch(section, "cwr", _cwr_flag);
+        _ece_flag = scenario_t::get_switch(section, "ece", _ece_flag);
+        _urg_flag = scenario_t::get_switch(section, "urg", _urg_flag);
+        _ack_flag = scenario_t::get_switch(section, "ack", _ack_flag);
+        _psh_flag = scenario_t::get_switch(section, "psh", _psh_flag);
+        _rst_flag = scenario_t::get_switch(section, "rst", _rst_flag);
+        _syn_flag = scenario_t::get_switch(section, "syn", _syn_flag);
+        _fin_flag = scenario_t::get_switch(section, "fin", _fin_flag);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void tcp_flags_setup::update_menu_items()
     {
         _cwr_flag_item->set_info(_cwr_flag ? "On" : "Off");
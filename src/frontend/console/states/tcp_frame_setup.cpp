@@ -201,6 +201,66 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t tcp_frame_setup::get_scenario_type() const
+    {
+        return "tcp";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void tcp_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_string(section, "src_port", _src_port_pattern);
+        scenario_t::set_string(section, "dst_port", _dst_port_pattern);
+        scenario_t::set_string(section, "seq_num", _seq_num_pattern);
+        scenario_t::set_string(section, "ack_num", _ack_num_pattern);
+
+        _flags_setup->save_scenario(section);
+
+        scenario_t::set_string(section, "win_size", _win_size_pattern);
+        scenario_t::set_string(section, "urg_pointer", _urg_pointer_pattern);
+
+        if (_payload->get_generator() != NULL)
+        {
+            _payload->save_scenario(
+                section->add_sub_section(scenario_t::SECTION_PAYLOAD));
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void tcp_frame_setup::load_scenario(section_t* section)
+    {
+        _payload->load_scenario(
+            scenario_t::find_sub_section(
+                section, scenario_t::SECTION_PAYLOAD));
+
+        _src_port_pattern = scenario_t::get_string(
+            section, "src_port", _src_port_pattern);
+
+        _dst_port_pattern = scenario_t::get_string(
+            section, "dst_port", _dst_port_pattern);
+
+        _seq_num_pattern = scenario_t::get_string(
+            section, "seq_num", _seq_num_pattern);
+
+        _ack_num_pattern = scenario_t::get_string(
+            section, "ack_num", _ack_num_pattern);
+
+        _flags_setup->load_scenario(section);
+
+        _win_size_pattern = scenario_t::get_string(
+            section, "win_size", _win_size_pattern);
+
+        _urg_pointer_pattern = scenario_t::get_string(
+            section, "urg_pointer", _urg_pointer_pattern);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void tcp_frame_setup::on_select()
     {
         get_ip_frame_setup()->set_protocol(_protocol);
@@ -107,6 +107,31 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t text_buffer_setup::get_scenario_type() const
+    {
+        return "text";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void text_buffer_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_string(section, "text", _text);
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void text_buffer_setup::load_scenario(section_t* section)
+    {
+        _text = scenario_t::get_string(
+            section, "text", _text);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void text_buffer_setup::update_menu_items()
     {
         _text_item->set_info(_text);
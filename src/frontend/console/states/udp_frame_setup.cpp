@@ -144,6 +144,45 @@ namespace hyenae::frontend::console::states
 
     /*---------------------------------------------------------------------- */
 
+    string_t udp_frame_setup::get_scenario_type() const
+    {
+        return "udp";
+
+    } /* get_scenario_type */
+
+    /*---------------------------------------------------------------------- */
+
+    void udp_frame_setup::save_scenario(section_t* section) const
+    {
+        scenario_t::set_string(section, "src_port", _src_port_pattern);
+        scenario_t::set_string(section, "dst_port", _dst_port_pattern);
+
+        if (_payload->get_generator() != NULL)
+        {
+            _payload->save_scenario(
+                section->add_sub_section(scenario_t::SECTION_PAYLOAD));
+        }
+
+    } /* save_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void udp_frame_setup::load_scenario(section_t* section)
+    {
+        _payload->load_scenario(
+            scenario_t::find_sub_section(
+                section, scenario_t::SECTION_PAYLOAD));
+
+        _src_port_pattern = scenario_t::get_string(
+            section, "src_port", _src_port_pattern);
+
+        _dst_port_pattern = scenario_t::get_string(
+            section, "dst_port", _dst_port_pattern);
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
     void udp_frame_setup::on_select()
     {
         get_ip_frame_setup()->set_protocol(_protocol);
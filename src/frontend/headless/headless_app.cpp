@@ -0,0 +1,331 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../include/assert.h"
+#include "../../../include/frontend/headless/headless_app.h"
+
+#include <csignal>
+#include <cstdio>
+
+namespace hyenae::frontend::headless
+{
+    /*---------------------------------------------------------------------- */
+
+    const string_t headless_app::ARG_SCENARIO = "--scenario";
+    const string_t headless_app::ARG_SCENARIO_SHORT = "-s";
+    const string_t headless_app::ARG_SET = "--set";
+
+    /*---------------------------------------------------------------------- */
+
+    const duration_t headless_app::INTERRUPT_POLL_INTERVAL =
+        std::chrono::milliseconds{ 100 };
+
+    /*---------------------------------------------------------------------- */
+
+    atomic_t<bool> headless_app::_interrupted = false;
+
+    /*---------------------------------------------------------------------- */
+
+    headless_app::headless_app(file_io::provider file_io_provider)
+    {
+        _file_io_provider = file_io_provider;
+        _scenario_config = new config(scenario::SECTION_ROOT);
+
+    } /* headless_app */
+
+    /*---------------------------------------------------------------------- */
+
+    headless_app::~headless_app()
+    {
+        safe_delete(_scenario_config);
+
+    } /* ~headless_app */
+
+    /*---------------------------------------------------------------------- */
+
+    bool headless_app::is_requested(int argc, char** argv)
+    {
+        string_t arg = "";
+
+        for (int i = 1; i < argc; i++)
+        {
+            arg = argv[i];
+
+            if (arg == ARG_SCENARIO ||
+                arg == ARG_SCENARIO_SHORT ||
+                arg == ARG_SET)
+            {
+                return true;
+            }
+        }
+
+        return false;
+
+    } /* is_requested */
+
+    /*---------------------------------------------------------------------- */
+
+    int headless_app::run(int argc, char** argv)
+    {
+        headless::scenario* scenario = NULL;
+        data_dispatcher_t* dispatcher = NULL;
+        bool completed = false;
+        int result = 0;
+
+        // Results are written as plain name=value lines, so that
+        // scripts can run and evaluate many scenarios in a row.
+
+        try
+        {
+            parse_args(argc, argv);
+
+            scenario = new headless::scenario(
+                _scenario_config->get_root_section(), _file_io_provider);
+
+            dispatcher = scenario->create_dispatcher();
+            dispatcher->add_listener(this);
+
+            completed = dispatch(dispatcher);
+
+            if (_thread_error != "")
+            {
+                result_out("status", "error");
+                result = -1;
+            }
+            else
+            {
+                result_out("status", completed ? "completed" : "interrupted");
+            }
+
+            results_out(dispatcher);
+
+            if (_thread_error != "")
+            {
+                result_out("error", _thread_error);
+            }
+        }
+        catch (const exception_t& exception)
+        {
+            result_out("status", "error");
+            result_out("error", exception.what());
+
+            result = -1;
+        }
+
+        safe_delete(dispatcher);
+        safe_delete(scenario);
+
+        fflush(stdout);
+
+        return result;
+
+    } /* run */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::on_thread_exception(const exception_t& exception)
+    {
+        // Only read once the dispatcher has been stopped and all of its
+        // threads have been joined. The first thread to fail stops all
+        // others, so it's error is the one to report.
+
+        if (_thread_error == "")
+        {
+            _thread_error = exception.what();
+        }
+
+    } /* on_thread_exception */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::parse_args(int argc, char** argv)
+    {
+        string_t arg = "";
+        vector_t<string_t> assignments;
+        bool loaded = false;
+
+        for (int i = 1; i < argc; i++)
+        {
+            arg = argv[i];
+
+            if (arg == ARG_SCENARIO || arg == ARG_SCENARIO_SHORT)
+            {
+                assert::valid_argument(i + 1 < argc, arg, "missing filename");
+                assert::valid_argument(!loaded, arg, "given more than once");
+
+                load_scenario(argv[++i]);
+
+                loaded = true;
+            }
+            else if (arg == ARG_SET)
+            {
+                assert::valid_argument(i + 1 < argc, arg, "missing value");
+
+                assignments.push_back(argv[++i]);
+            }
+            else
+            {
+                assert::valid_argument(false, arg, "unknown argument");
+            }
+        }
+
+        // Values given as arguments override those of the scenario
+        // file, no matter in which order they were given.
+
+        for (auto assignment : assignments)
+        {
+            set_value(assignment);
+        }
+
+    } /* parse_args */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::load_scenario(const string_t& filename)
+    {
+        config* scenario_config = scenario::load(_file_io_provider, filename);
+
+        safe_delete(_scenario_config);
+
+        _scenario_config = scenario_config;
+
+    } /* load_scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::set_value(const string_t& assignment)
+    {
+        config::section* section = _scenario_config->get_root_section();
+        size_t pos = assignment.find(config::VALUE_ASSIGNER);
+        string_t path = "";
+        string_t value = "";
+
+        // Values are addressed by their section path,
+        // e.g. "generator.payload.dst_ip=10.0.0.1".
+
+        assert::valid_format(
+            pos != string_t::npos && pos > 0,
+            ARG_SET,
+            concat("expected <section>.<name>=<value>: ", assignment));
+
+        path = trim(assignment.substr(0, pos));
+        value = trim(assignment.substr(pos + 1));
+
+        while ((pos = path.find('.')) != string_t::npos)
+        {
+            section = section->get_or_create_sub_section(path.substr(0, pos));
+            path = path.substr(pos + 1);
+        }
+
+        section->get_or_create_value(path, value)->set_value(value);
+
+    } /* set_value */
+
+    /*---------------------------------------------------------------------- */
+
+    bool headless_app::dispatch(data_dispatcher_t* dispatcher)
+    {
+        _interrupted = false;
+
+        std::signal(SIGINT, on_interrupt);
+        std::signal(SIGTERM, on_interrupt);
+
+        dispatcher->start();
+
+        // Sleeps until the run ends, only waking up now and then
+        // to check if it has been interrupted in the meantime.
+
+        while (!dispatcher->wait_for_stop(INTERRUPT_POLL_INTERVAL))
+        {
+            if (_interrupted)
+            {
+                dispatcher->stop();
+            }
+        }
+
+        // Joins workers that stopped on their own
+
+        dispatcher->stop();
+
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+
+        return !_interrupted;
+
+    } /* dispatch */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::results_out(const data_dispatcher_t* dispatcher)
+    {
+        data_dispatcher_t::stats::snapshot stats =
+            dispatcher->get_stats()->get_snapshot();
+
+        double seconds =
+            std::chrono::duration<double>(stats.duration).count();
+
+        result_out("bytes", std::to_string(stats.byte_count));
+        result_out("packets", std::to_string(stats.packet_count));
+        result_out("duration_ms", std::to_string(to_ms(stats.duration)));
+
+        result_out("packet_rate", std::to_string(seconds > 0 ?
+            (uint64_t)(stats.packet_count / seconds) : 0));
+
+        result_out("bit_rate", std::to_string(seconds > 0 ?
+            (uint64_t)(stats.byte_count * 8 / seconds) : 0));
+
+        result_out("workers", std::to_string(dispatcher->get_worker_count()));
+
+        result_out(
+            "cached_packets", std::to_string(stats.cached_packet_count));
+
+        result_out("ring_full", std::to_string(stats.ring_full_count));
+        result_out("ring_empty", std::to_string(stats.ring_empty_count));
+
+        result_out(
+            "send_failures", std::to_string(stats.send_failure_count));
+
+    } /* results_out */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::on_interrupt(int signal)
+    {
+        _interrupted = true;
+
+    } /* on_interrupt */
+
+    /*---------------------------------------------------------------------- */
+
+    void headless_app::result_out(const string_t& name, const string_t& value)
+    {
+        fprintf(stdout, "%s=%s\n", name.c_str(), value.c_str());
+
+    } /* result_out */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::frontend::headless */
@@ -0,0 +1,923 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../include/assert.h"
+#include "../../../include/model/fixed_duration_generator.h"
+#include "../../../include/model/random_duration_generator.h"
+#include "../../../include/model/token_bucket.h"
+#include "../../../include/model/random_engine.h"
+#include "../../../include/model/generators/string_generator.h"
+#include "../../../include/model/generators/protocols/ethernet_frame_generator.h"
+#include "../../../include/model/generators/protocols/arp_frame_generator.h"
+#include "../../../include/model/generators/protocols/ip_v4_frame_generator.h"
+#include "../../../include/model/generators/protocols/ip_v6_frame_generator.h"
+#include "../../../include/model/generators/protocols/icmp_v4_frame_generator.h"
+#include "../../../include/model/generators/protocols/icmp_v6_frame_generator.h"
+#include "../../../include/model/generators/protocols/icmp_echo_payload_generator.h"
+#include "../../../include/model/generators/protocols/tcp_frame_generator.h"
+#include "../../../include/model/generators/protocols/udp_frame_generator.h"
+#include "../../../include/model/outputs/no_output.h"
+#include "../../../include/model/outputs/file_output.h"
+#include "../../../include/model/outputs/capture_file_output.h"
+#include "../../../include/model/outputs/packet_mmap_output.h"
+#include "../../../include/frontend/headless/scenario.h"
+
+namespace hyenae::frontend::headless
+{
+    /*---------------------------------------------------------------------- */
+
+    const string_t scenario::SECTION_ROOT = "scenario";
+    const string_t scenario::SECTION_OUTPUT = "output";
+    const string_t scenario::SECTION_GENERATOR = "generator";
+    const string_t scenario::SECTION_PAYLOAD = "payload";
+    const string_t scenario::SECTION_DISPATCHER = "dispatcher";
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::scenario(
+        section_t* section, file_io::provider file_io_provider)
+    {
+        assert::argument_not_null(section, "section");
+
+        _file_io_provider = file_io_provider;
+
+        try
+        {
+            if (section->has_value("seed"))
+            {
+                model::random_engine::set_default_seed(
+                    get_number(section, "seed", 0));
+            }
+
+            parse_output(section->get_or_create_sub_section(SECTION_OUTPUT));
+
+            assert::legal_state(
+                section->has_sub_section(SECTION_GENERATOR),
+                "",
+                "No generator assigned");
+
+            _generator = parse_generator(
+                section->sub_section_by_name(SECTION_GENERATOR),
+                GFLAG_ETHERNET_FRAME | GFLAG_TEXT_BUFFER);
+
+            parse_dispatcher(
+                section->get_or_create_sub_section(SECTION_DISPATCHER));
+        }
+        catch (const exception_t&)
+        {
+            // The destructor won't be called for a scenario
+            // that failed to construct.
+
+            clear();
+
+            throw;
+        }
+
+    } /* scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::scenario(file_io::provider file_io_provider)
+    {
+        _file_io_provider = file_io_provider;
+
+    } /* scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::~scenario()
+    {
+        clear();
+
+    } /* ~scenario */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::validate(
+        section_t* section, file_io::provider file_io_provider)
+    {
+        scenario result(file_io_provider);
+
+        assert::argument_not_null(section, "section");
+
+        // Parses every section without applying the seed, so that the
+        // console can reject a scenario before loading any part of it.
+        // A scenario without a generator is valid there.
+
+        result.parse_output(
+            section->get_or_create_sub_section(SECTION_OUTPUT));
+
+        if (section->has_sub_section(SECTION_GENERATOR))
+        {
+            result._generator = result.parse_generator(
+                section->sub_section_by_name(SECTION_GENERATOR),
+                GFLAG_ETHERNET_FRAME | GFLAG_TEXT_BUFFER);
+        }
+
+        result.parse_dispatcher(
+            section->get_or_create_sub_section(SECTION_DISPATCHER));
+
+    } /* validate */
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::data_dispatcher_t* scenario::create_dispatcher()
+    {
+        return new data_dispatcher_t(
+            _output,
+            _generator,
+            _delay,
+            _limits,
+            _worker_count,
+            _batch_size,
+            _pacer,
+            _wait_policy,
+            _ring_depth,
+            _cache_size,
+            _stats_interval);
+
+    } /* create_dispatcher */
+
+    /*---------------------------------------------------------------------- */
+
+    config* scenario::load(
+        file_io::provider file_io_provider, const string_t& filename)
+    {
+        file_io* file_io = file_io_provider();
+        string_t text = "";
+
+        try
+        {
+            assert::valid_argument(
+                file_io->exists(filename),
+                filename,
+                "scenario file not found");
+
+            file_io->open(filename, false);
+            text = file_io->read_all();
+            file_io->close();
+        }
+        catch (const exception_t& exception)
+        {
+            file_io->close();
+            safe_delete(file_io);
+
+            throw runtime_error_t(exception.what());
+        }
+
+        safe_delete(file_io);
+
+        return config::parse(text);
+
+    } /* load */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::save(
+        file_io::provider file_io_provider,
+        const string_t& filename,
+        config* scenario)
+    {
+        file_io* file_io = file_io_provider();
+
+        assert::argument_not_null(scenario, "scenario");
+
+        try
+        {
+            file_io->open(filename, true);
+            file_io->write(scenario->to_string());
+            file_io->close();
+        }
+        catch (const exception_t& exception)
+        {
+            file_io->close();
+            safe_delete(file_io);
+
+            throw runtime_error_t(exception.what());
+        }
+
+        safe_delete(file_io);
+
+    } /* save */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::clear()
+    {
+        safe_delete(_output);
+        safe_delete(_device);
+        safe_delete(_generator);
+        safe_delete(_delay);
+        safe_delete(_pacer);
+        safe_delete(_limits);
+
+    } /* clear */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::parse_output(section_t* section)
+    {
+        using capture_format_t =
+            model::outputs::capture_file_output::format;
+
+        string_t type = get_string(section, "type", "none");
+        string_t format = "";
+
+        if (type == "none")
+        {
+            _output = new model::outputs::no_output();
+        }
+        else if (type == "file")
+        {
+            _output = new model::outputs::file_output(
+                _file_io_provider, get_string(section, "path"));
+        }
+        else if (type == "capture_file")
+        {
+            format = get_string(section, "format", "pcap");
+
+            assert::valid_format(
+                format == "pcap" || format == "pcapng",
+                "format",
+                "expected pcap or pcapng");
+
+            _output = new model::outputs::capture_file_output(
+                _file_io_provider,
+                get_string(section, "path"),
+                format == "pcap" ?
+                    capture_format_t::PCAP : capture_format_t::PCAPNG,
+                get_switch(section, "nanoseconds"));
+        }
+        else if (type == "network" || type == "packet_mmap")
+        {
+            _device = find_device(get_string(section, "device"));
+
+            if (type == "network")
+            {
+                _output = new model::outputs::network_output(_device);
+            }
+            else
+            {
+                assert::legal_state(
+                    model::outputs::packet_mmap_output::is_supported(),
+                    "",
+                    "TX ring output not supported on this platform");
+
+                _output = new model::outputs::packet_mmap_output(_device);
+            }
+        }
+        else
+        {
+            assert::valid_format(false, "type", "unknown output type");
+        }
+
+    } /* parse_output */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::parse_dispatcher(section_t* section)
+    {
+        string_t wait_policy = "";
+
+        _limits = new limits_t(
+            get_number(section, "byte_limit", limits_t::SIZE_UNLIMITED),
+            get_number(section, "packet_limit", limits_t::SIZE_UNLIMITED),
+            std::chrono::milliseconds{ get_number(
+                section, "duration_limit", 0, INT64_MAX) });
+
+        _worker_count = get_number(section, "workers", 1, MAX_WORKER_COUNT);
+        _batch_size = get_number(section, "batch_size", 1, MAX_BATCH_SIZE);
+
+        assert::valid_format(_worker_count > 0, "workers", "expected > 0");
+        assert::valid_format(_batch_size > 0, "batch_size", "expected > 0");
+
+        _ring_depth = get_number(
+            section,
+            "ring_depth",
+            data_dispatcher_t::RING_DISABLED,
+            MAX_RING_DEPTH);
+
+        // Cache size is given in KB, just like in the dispatcher setup
+
+        _cache_size = get_number(
+            section,
+            "cache_size",
+            data_dispatcher_t::CACHE_DISABLED,
+            MAX_CACHE_SIZE) * 1024;
+
+        // Interval at which the stats are published (ms)
+
+        _stats_interval = std::chrono::milliseconds{ get_number(
+            section,
+            "stats_interval",
+            to_ms(data_dispatcher_t::DEFAULT_STATS_INTERVAL),
+            MAX_STATS_INTERVAL) };
+
+        assert::in_range(
+            _stats_interval > duration_t{ 0 }, "stats_interval");
+
+        wait_policy = get_string(section, "wait_policy", "hybrid");
+
+        if (wait_policy == "busy_poll")
+        {
+            _wait_policy = wait_policy_t::BUSY_POLL;
+        }
+        else if (wait_policy == "hybrid")
+        {
+            _wait_policy = wait_policy_t::HYBRID;
+        }
+        else if (wait_policy == "sleep")
+        {
+            _wait_policy = wait_policy_t::SLEEP;
+        }
+        else
+        {
+            assert::valid_format(
+                false, "wait_policy", "expected busy_poll, hybrid or sleep");
+        }
+
+        parse_delay(section);
+
+    } /* parse_dispatcher */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::parse_delay(section_t* section)
+    {
+        string_t type = get_string(section, "delay", "none");
+
+        if (type == "fixed")
+        {
+            _delay = new model::fixed_duration_generator(
+                std::chrono::milliseconds{ get_number(
+                    section, "delay_duration", 0, INT64_MAX) });
+        }
+        else if (type == "random")
+        {
+            _delay = new model::random_duration_generator(
+                std::chrono::milliseconds{ get_number(
+                    section, "delay_min", 0, INT64_MAX) },
+                std::chrono::milliseconds{ get_number(
+                    section, "delay_max", 0, INT64_MAX) });
+        }
+        else if (type == "rate")
+        {
+            _pacer = new pacer_t(
+                get_number(section, "packet_rate", pacer_t::RATE_UNLIMITED),
+                get_number(
+                    section,
+                    "bit_rate",
+                    pacer_t::RATE_UNLIMITED,
+                    UINT64_MAX / 1000) * 1000,
+                get_number(section, "burst_size", 1, INT32_MAX));
+        }
+        else
+        {
+            assert::valid_format(
+                type == "none",
+                "delay",
+                "expected none, fixed, random or rate");
+        }
+
+    } /* parse_delay */
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::data_generator_t* scenario::parse_generator(
+        section_t* section,
+        size_t generator_flags,
+        data_generator_t* pseudo_header)
+    {
+        using namespace model::generators::protocols;
+
+        string_t type = get_string(section, "type");
+        string_t payload_type = "";
+        string_t operation = "";
+        section_t* payload = NULL;
+        size_t payload_flags = 0;
+        uint64_t protocol = 0;
+        data_generator_t* payload_pseudo_header = NULL;
+        generator_group_t* payload_group = NULL;
+        data_generator_t* generator = NULL;
+
+        assert::valid_format(
+            (to_generator_flag(type) & generator_flags) != 0,
+            "type",
+            concat("unexpected generator type: ", type));
+
+        if (section->has_sub_section(SECTION_PAYLOAD))
+        {
+            payload = section->sub_section_by_name(SECTION_PAYLOAD);
+            payload_type = get_string(payload, "type");
+        }
+
+        // Fields that identify the payload (ethernet type, IP protocol,
+        // ICMP type) are derived from it, unless set explicitly.
+
+        protocol = to_protocol(type, payload_type);
+
+        if (type == "ethernet")
+        {
+            generator = new ethernet_frame_generator(
+                get_switch(section, "preamble_sfd"),
+                get_string(
+                    section, "src_mac", address_generator::RAND_MAC_PATTERN),
+                get_string(
+                    section, "dst_mac", address_generator::RAND_MAC_PATTERN),
+                get_number(section, "ether_type", protocol, UINT16_MAX),
+                get_switch(section, "fcs"));
+
+            payload_group = ((ethernet_frame_generator*)generator)->
+                get_payload();
+
+            payload_flags =
+                GFLAG_ARP_FRAME |
+                GFLAG_IP_V4_FRAME |
+                GFLAG_IP_V6_FRAME |
+                GFLAG_TEXT_BUFFER;
+        }
+        else if (type == "arp")
+        {
+            operation = get_string(section, "operation", "request");
+
+            assert::valid_format(
+                operation == "request" || operation == "reply",
+                "operation",
+                "expected request or reply");
+
+            generator = arp_frame_generator::create_for_ip_v4_over_ethernet(
+                operation == "request" ?
+                    arp_frame_generator::OPERATION_REQUEST :
+                    arp_frame_generator::OPERATION_REPLY,
+                get_string(
+                    section,
+                    "sender_mac",
+                    address_generator::RAND_MAC_PATTERN),
+                get_string(
+                    section,
+                    "sender_ip",
+                    address_generator::RAND_IP_V4_PATTERN),
+                get_string(
+                    section,
+                    "target_mac",
+                    address_generator::RAND_MAC_PATTERN),
+                get_string(
+                    section,
+                    "target_ip",
+                    address_generator::RAND_IP_V4_PATTERN));
+        }
+        else if (type == "ip_v4")
+        {
+            generator = new ip_v4_frame_generator(
+                get_number(section, "tos", 0, UINT8_MAX),
+                get_string(section, "id", "*****"),
+                10,
+                get_switch(section, "dont_frag"),
+                get_switch(section, "more_frags"),
+                get_string(section, "frag_offset", "0"),
+                10,
+                get_number(section, "ttl", 128, UINT8_MAX),
+                get_number(section, "protocol", protocol, UINT8_MAX),
+                get_string(
+                    section, "src_ip", address_generator::RAND_IP_V4_PATTERN),
+                get_string(
+                    section, "dst_ip", address_generator::RAND_IP_V4_PATTERN));
+
+            payload_group = ((ip_v4_frame_generator*)generator)->
+                get_payload();
+
+            payload_pseudo_header =
+                ((ip_v4_frame_generator*)generator)->get_pseudo_header();
+
+            payload_flags =
+                GFLAG_ICMP_V4_FRAME |
+                GFLAG_TCP_FRAME |
+                GFLAG_UDP_FRAME |
+                GFLAG_TEXT_BUFFER;
+        }
+        else if (type == "ip_v6")
+        {
+            generator = new ip_v6_frame_generator(
+                get_number(section, "traffic_class", 0, UINT8_MAX),
+                get_string(section, "flow_label", "*****"),
+                10,
+                get_number(section, "next_header", protocol, UINT8_MAX),
+                get_number(section, "hop_limit", 128, UINT8_MAX),
+                get_string(
+                    section, "src_ip", address_generator::RAND_IP_V6_PATTERN),
+                get_string(
+                    section, "dst_ip", address_generator::RAND_IP_V6_PATTERN));
+
+            payload_group = ((ip_v6_frame_generator*)generator)->
+                get_payload();
+
+            payload_pseudo_header =
+                ((ip_v6_frame_generator*)generator)->get_pseudo_header();
+
+            payload_flags =
+                GFLAG_ICMP_V4_FRAME |
+                GFLAG_ICMP_V6_FRAME |
+                GFLAG_TCP_FRAME |
+                GFLAG_UDP_FRAME |
+                GFLAG_TEXT_BUFFER;
+        }
+        else if (type == "icmp_v4")
+        {
+            generator = new icmp_v4_frame_generator(
+                get_number(section, "icmp_type", protocol, UINT8_MAX),
+                get_number(section, "code", 0, UINT8_MAX));
+
+            payload_group = ((icmp_v4_frame_generator*)generator)->
+                get_payload();
+
+            payload_flags = GFLAG_ICMP_ECHO_PAYLOAD;
+        }
+        else if (type == "icmp_v6")
+        {
+            generator = new icmp_v6_frame_generator(
+                pseudo_header,
+                get_number(section, "icmp_type", protocol, UINT8_MAX),
+                get_number(section, "code", 0, UINT8_MAX));
+
+            payload_group = ((icmp_v6_frame_generator*)generator)->
+                get_payload();
+
+            payload_flags = GFLAG_ICMP_ECHO_PAYLOAD;
+        }
+        else if (type == "icmp_echo")
+        {
+            generator = new icmp_echo_payload_generator(
+                get_string(section, "id", "*****"),
+                10,
+                get_string(section, "seq_num", "*****"),
+                10);
+        }
+        else if (type == "tcp")
+        {
+            generator = new tcp_frame_generator(
+                pseudo_header,
+                get_string(section, "src_port", "****"),
+                10,
+                get_string(section, "dst_port", "****"),
+                10,
+                get_string(section, "seq_num", "*****"),
+                10,
+                get_string(section, "ack_num", "*****"),
+                10,
+                get_switch(section, "cwr"),
+                get_switch(section, "ece"),
+                get_switch(section, "urg"),
+                get_switch(section, "ack"),
+                get_switch(section, "psh"),
+                get_switch(section, "rst"),
+                get_switch(section, "syn"),
+                get_switch(section, "fin"),
+                get_string(section, "win_size", "*****"),
+                10,
+                get_string(section, "urg_pointer", "*****"),
+                10);
+
+            payload_group = ((tcp_frame_generator*)generator)->
+                get_payload();
+
+            payload_flags = GFLAG_TEXT_BUFFER;
+        }
+        else if (type == "udp")
+        {
+            generator = new udp_frame_generator(
+                pseudo_header,
+                get_string(section, "src_port", "****"),
+                10,
+                get_string(section, "dst_port", "****"),
+                10);
+
+            payload_group = ((udp_frame_generator*)generator)->
+                get_payload();
+
+            payload_flags = GFLAG_TEXT_BUFFER;
+        }
+        else if (type == "text")
+        {
+            generator = new model::generators::string_generator(
+                get_string(section, "text"),
+                model::generators::string_generator::encoding::ASCII);
+        }
+
+        if (payload != NULL)
+        {
+            try
+            {
+                assert::valid_format(
+                    payload_flags != 0,
+                    "payload",
+                    concat(type, " does not take a payload"));
+
+                // Payloads are owned by the group they were added to,
+                // just like those of a cloned generator.
+
+                payload_group->adopt_generator(
+                    parse_generator(
+                        payload, payload_flags, payload_pseudo_header));
+            }
+            catch (const exception_t&)
+            {
+                safe_delete(generator);
+
+                throw;
+            }
+        }
+
+        return generator;
+
+    } /* parse_generator */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t scenario::to_generator_flag(const string_t& type)
+    {
+        if (type == "ethernet")
+        {
+            return GFLAG_ETHERNET_FRAME;
+        }
+        else if (type == "arp")
+        {
+            return GFLAG_ARP_FRAME;
+        }
+        else if (type == "ip_v4")
+        {
+            return GFLAG_IP_V4_FRAME;
+        }
+        else if (type == "ip_v6")
+        {
+            return GFLAG_IP_V6_FRAME;
+        }
+        else if (type == "icmp_v4")
+        {
+            return GFLAG_ICMP_V4_FRAME;
+        }
+        else if (type == "icmp_v6")
+        {
+            return GFLAG_ICMP_V6_FRAME;
+        }
+        else if (type == "icmp_echo")
+        {
+            return GFLAG_ICMP_ECHO_PAYLOAD;
+        }
+        else if (type == "tcp")
+        {
+            return GFLAG_TCP_FRAME;
+        }
+        else if (type == "udp")
+        {
+            return GFLAG_UDP_FRAME;
+        }
+        else if (type == "text")
+        {
+            return GFLAG_TEXT_BUFFER;
+        }
+
+        return 0;
+
+    } /* to_generator_flag */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t scenario::to_protocol(
+        const string_t& type, const string_t& payload_type)
+    {
+        using namespace model::generators::protocols;
+
+        // Same values the console setups assign, once a payload
+        // generator has been selected.
+
+        if (type == "ethernet")
+        {
+            if (payload_type == "arp")
+            {
+                return ethernet_frame_generator::TYPE_ARP;
+            }
+            else if (payload_type == "ip_v6")
+            {
+                return ethernet_frame_generator::TYPE_IP_V6;
+            }
+
+            return ethernet_frame_generator::TYPE_IP_V4;
+        }
+        else if (type == "ip_v4")
+        {
+            if (payload_type == "icmp_v4")
+            {
+                return icmp_v4_frame_generator::IP_V4_PROTOCOL;
+            }
+            else if (payload_type == "tcp")
+            {
+                return tcp_frame_generator::IP_V4_PROTOCOL;
+            }
+            else if (payload_type == "udp")
+            {
+                return udp_frame_generator::IP_V4_PROTOCOL;
+            }
+        }
+        else if (type == "ip_v6")
+        {
+            if (payload_type == "icmp_v4")
+            {
+                return icmp_v4_frame_generator::IP_V6_PROTOCOL;
+            }
+            else if (payload_type == "icmp_v6")
+            {
+                return icmp_v6_frame_generator::IP_V6_PROTOCOL;
+            }
+            else if (payload_type == "tcp")
+            {
+                return tcp_frame_generator::IP_V6_NEXT_HEADER;
+            }
+            else if (payload_type == "udp")
+            {
+                return udp_frame_generator::IP_V6_NEXT_HEADER;
+            }
+        }
+        else if (type == "icmp_v4" && payload_type == "icmp_echo")
+        {
+            return icmp_echo_payload_generator::ICMP_V4_TYPE;
+        }
+        else if (type == "icmp_v6" && payload_type == "icmp_echo")
+        {
+            return icmp_echo_payload_generator::ICMP_V6_TYPE;
+        }
+
+        return 0;
+
+    } /* to_protocol */
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::device_t* scenario::find_device(const string_t& name)
+    {
+        vector_t<device_t*> devices;
+        device_t* result = NULL;
+
+        model::outputs::network_output::list_devices(devices);
+
+        for (auto device : devices)
+        {
+            if (result == NULL && device->get_name() == name)
+            {
+                result = device;
+            }
+            else
+            {
+                safe_delete(device);
+            }
+        }
+
+        assert::valid_argument(
+            result != NULL, "device", concat("unknown device: ", name));
+
+        return result;
+
+    } /* find_device */
+
+    /*---------------------------------------------------------------------- */
+
+    scenario::section_t* scenario::find_sub_section(
+        section_t* section, const string_t& name)
+    {
+        if (section->has_sub_section(name))
+        {
+            return section->sub_section_by_name(name);
+        }
+
+        return NULL;
+
+    } /* find_sub_section */
+
+    /*---------------------------------------------------------------------- */
+
+    string_t scenario::get_string(
+        section_t* section,
+        const string_t& name,
+        const string_t& default_value)
+    {
+        if (section->has_value(name))
+        {
+            return section->value_by_name(name)->get_value();
+        }
+
+        return default_value;
+
+    } /* get_string */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t scenario::get_number(
+        section_t* section,
+        const string_t& name,
+        uint64_t default_value,
+        uint64_t max_value)
+    {
+        string_t value = get_string(section, name);
+        uint64_t result = default_value;
+
+        if (value != "")
+        {
+            assert::valid_format(
+                value.find_first_not_of("0123456789") == string_t::npos,
+                name,
+                concat("not a number: ", value));
+
+            try
+            {
+                result = std::stoull(value);
+            }
+            catch (const std::out_of_range&)
+            {
+                assert::in_range(false, name);
+            }
+        }
+
+        assert::in_range(result <= max_value, name);
+
+        return result;
+
+    } /* get_number */
+
+    /*---------------------------------------------------------------------- */
+
+    bool scenario::get_switch(
+        section_t* section,
+        const string_t& name,
+        bool default_value)
+    {
+        string_t value = get_string(
+            section, name, default_value ? "on" : "off");
+
+        assert::valid_format(
+            value == "on" || value == "off",
+            name,
+            "expected on or off");
+
+        return value == "on";
+
+    } /* get_switch */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::set_string(
+        section_t* section, const string_t& name, const string_t& value)
+    {
+        // Values can't hold the delimiters of the config format
+
+        assert::valid_format(
+            value.find_first_of(";{}=") == string_t::npos,
+            name,
+            concat("reserved character in value: ", value));
+
+        section->get_or_create_value(name, value)->set_value(value);
+
+    } /* set_string */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::set_number(
+        section_t* section, const string_t& name, uint64_t value)
+    {
+        set_string(section, name, std::to_string(value));
+
+    } /* set_number */
+
+    /*---------------------------------------------------------------------- */
+
+    void scenario::set_switch(
+        section_t* section, const string_t& name, bool value)
+    {
+        set_string(section, name, value ? "on" : "off");
+
+    } /* set_switch */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::frontend::headless */
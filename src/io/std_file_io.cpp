@@ -61,14 +61,24 @@ namespace hyenae::io
 
     /*---------------------------------------------------------------------- */
 
-    void std_file_io::open(const string_t& filename, bool overwrite)
+    void std_file_io::open(
+        const string_t& filename, bool overwrite, bool binary)
     {
+        std::ios_base::openmode mode =
+            std::fstream::in | std::fstream::out |
+            (overwrite ? std::ios_base::trunc : std::ios_base::app);
+
         assert::legal_call(!is_open(), "", "already open");
 
-        _stream.open(
-            filename,
-            std::fstream::in | std::fstream::out |
-                (overwrite ? std::ios_base::trunc : std::ios_base::app));
+        // Without binary mode, line endings would be
+        // translated on some platforms (e.g. Windows).
+
+        if (binary)
+        {
+            mode |= std::ios_base::binary;
+        }
+
+        _stream.open(filename, mode);
         
         assert::legal_call(!_stream.fail(), "", "failed to open");
 
@@ -27,27 +27,88 @@
 #include "../../include/assert.h"
 #include "../../include/stop_watch.h"
 #include "../../include/model/data_dispatcher.h"
+#include "../../include/model/packet_template.h"
 
-#include <cstdlib>
 #include <cstring>
+#include <algorithm>
 
 namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
 
+    // Sleeping is only accurate to some tens of microseconds, the
+    // remainder of a delay is always spent spinning.
+
+    const duration_t data_dispatcher::SPIN_DURATION =
+        std::chrono::microseconds{ 100 };
+
+    const duration_t data_dispatcher::PAUSE_TIMEOUT =
+        std::chrono::milliseconds{ 100 };
+
+    const duration_t data_dispatcher::DEFAULT_STATS_INTERVAL =
+        std::chrono::milliseconds{ 100 };
+
+    /*---------------------------------------------------------------------- */
+
     data_dispatcher::data_dispatcher(
         data_output* output,
         data_generator* generator,
         duration_generator* delay,
-        limits* limits)
+        limits* limits,
+        size_t worker_count,
+        size_t batch_size,
+        token_bucket* pacer,
+        wait_policy policy,
+        size_t ring_depth,
+        size_t cache_size,
+        duration_t stats_interval)
     {
+        data_output* output_clone = NULL;
+
         assert::argument_not_null(output, "", "No output assigned");
         assert::argument_not_null(generator, "", "No generator assigned");
+        assert::in_range(worker_count > 0, "worker_count");
+        assert::in_range(batch_size > 0, "batch_size");
+        assert::in_range(
+            stats_interval > duration_t{ 0 }, "stats_interval");
+
+        _stats.init(worker_count);
+
+        // The first worker uses the given output and generator, all others
+        // work on private clones so that no per-packet state is shared.
+        // Each clone starts one value further into the sequence and all
+        // of them step ahead by the worker count, so that the workers
+        // take turns instead of sending every value once each. Clones
+        // start at the first value, so the given generator is reset to
+        // it as well (e.g. after a previous run).
+
+        generator->reset();
+
+        _outputs.push_back(output);
+        _generators.push_back(generator);
+
+        for (size_t i = 1; i < worker_count; i++)
+        {
+            output_clone = output->clone();
+
+            assert::legal_state(
+                output_clone != NULL,
+                "",
+                "Output does not support multiple workers");
+
+            _outputs.push_back(output_clone);
+            _generators.push_back(generator->clone());
+            _generators.back()->next(true, i);
+        }
 
-        _output = output;
-        _generator = generator;
         _delay = delay;
+        _pacer = pacer;
+        _wait_policy = policy;
         _limits = limits;
+        _batch_size = batch_size;
+        _ring_depth = ring_depth;
+        _cache_size = cache_size;
+        _stats_interval = stats_interval;
 
     } /* data_dispatcher */
 
@@ -57,10 +118,64 @@ namespace hyenae::model
     {
         stop();
 
+        for (size_t i = 1; i < _outputs.size(); i++)
+        {
+            safe_delete(_outputs[i]);
+            safe_delete(_generators[i]);
+        }
+
     } /* ~data_dispatcher */
 
     /*---------------------------------------------------------------------- */
 
+    size_t data_dispatcher::get_worker_count() const
+    {
+        return _outputs.size();
+
+    } /* get_worker_count */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_dispatcher::get_batch_size() const
+    {
+        return _batch_size;
+
+    } /* get_batch_size */
+
+    /*---------------------------------------------------------------------- */
+
+    data_dispatcher::wait_policy data_dispatcher::get_wait_policy() const
+    {
+        return _wait_policy;
+
+    } /* get_wait_policy */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_dispatcher::get_ring_depth() const
+    {
+        return _ring_depth;
+
+    } /* get_ring_depth */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_dispatcher::get_cache_size() const
+    {
+        return _cache_size;
+
+    } /* get_cache_size */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t data_dispatcher::get_stats_interval() const
+    {
+        return _stats_interval;
+
+    } /* get_stats_interval */
+
+    /*---------------------------------------------------------------------- */
+
     data_dispatcher::state data_dispatcher::get_state() const
     {
         return _state;
@@ -105,7 +220,36 @@ namespace hyenae::model
     {
         assert::legal_call(is_stopped(), "", "allready started");
 
-        _thread = new thread_t(data_dispatcher::thread_proc, this);
+        // Workers that stopped on their own (limit or error)
+        // still have to be joined before starting over.
+
+        join_threads();
+
+        _stats.reset();
+        _claimed_bytes = 0;
+        _claimed_packets = 0;
+        _limit_reached = false;
+
+        if (_delay != NULL)
+        {
+            _delay->reset();
+        }
+
+        if (_pacer != NULL)
+        {
+            _pacer->reset();
+        }
+
+        set_state(state::RUNNING);
+
+        for (size_t i = 0; i < _outputs.size(); i++)
+        {
+            _threads.push_back(
+                new thread_t(data_dispatcher::thread_proc, this, i));
+        }
+
+        _threads.push_back(
+            new thread_t(data_dispatcher::reporter_proc, this));
 
         if (wait_for_start)
         {
@@ -146,23 +290,33 @@ namespace hyenae::model
     {
         set_state(state::STOPPED);
 
-        if (_thread != NULL)
-        {
-            _thread->join();
-
-            safe_delete(_thread);
-        }
+        join_threads();
 
     } /* stop */
 
     /*---------------------------------------------------------------------- */
 
-    void data_dispatcher::set_state(state state)
+    bool data_dispatcher::wait_for_stop(duration_t timeout)
     {
-        if (_state != state)
+        std::unique_lock<mutex_t> lock(_state_mutex);
+
+        // Lets frontends wait for the end of a run without polling,
+        // no matter if it was stopped, hit a limit or failed.
+
+        return _state_condition.wait_for(lock, timeout, [this]()
         {
-            _state = state;
+            return _state == state::STOPPED;
+        });
+
+    } /* wait_for_stop */
 
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::set_state(state state)
+    {
+        if (_state.exchange(state) != state)
+        {
+            wake_workers();
             state_changed();
         }
 
@@ -181,102 +335,662 @@ namespace hyenae::model
 
     /*---------------------------------------------------------------------- */
 
-    void data_dispatcher::thread_proc(void* param)
+    void data_dispatcher::wake_workers()
     {
-        ((data_dispatcher*)param)->dispatcher_loop();
+        // Taking the lock makes sure that no worker is between
+        // checking the state and starting to wait for a change.
+
+        {
+            std::lock_guard<mutex_t> lock(_state_mutex);
+        }
+
+        _state_condition.notify_all();
+
+    } /* wake_workers */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::join_threads()
+    {
+        for (auto thread : _threads)
+        {
+            thread->join();
+
+            safe_delete(thread);
+        }
+
+        _threads.clear();
+
+    } /* join_threads */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::thread_proc(
+        data_dispatcher* dispatcher, size_t index)
+    {
+        dispatcher->dispatcher_loop(index);
 
     } /* run_thread_proc */
 
     /*---------------------------------------------------------------------- */
 
-    void data_dispatcher::dispatcher_loop()
+    void data_dispatcher::dispatcher_loop(size_t index)
     {
+        data_output* output = _outputs[index];
+        data_generator* generator = _generators[index];
+        stats::counters* counters = _stats.counters_at(index);
+        packet_template* packet = NULL;
+        packet_ring* ring = NULL;
+        thread_t* producer = NULL;
         byte_t* data = NULL;
+        byte_t* slot = NULL;
         size_t data_size = 0;
+        size_t failure_count = 0;
+        vector_t<byte_t> batch_buffer;
+        vector_t<byte_t> cache;
+        size_t cache_period = 0;
+        size_t cache_index = 0;
+        vector_t<data_output::span> batch;
+        bool flushed = true;
+        bool empty = false;
         duration_t time_to_wait = duration_t{ 0 };
+        duration_t time_left = duration_t{ 0 };
+        duration_t now = duration_t{ 0 };
         stop_watch delay_watch;
         stop_watch duration_watch;
 
         try
         {
-            _stats.reset();
+            output->open();
+
+            // Only fields that change between packets
+            // are rendered again for each of them.
 
-            if (_delay != NULL)
+            packet = new packet_template(generator, get_worker_count());
+            data_size = packet->size();
+
+            if (_batch_size > 1)
             {
-                _delay->reset();
+                batch_buffer.resize(_batch_size * data_size);
+                batch.reserve(_batch_size);
             }
 
-            set_state(state::RUNNING);
+            if (_cache_size != CACHE_DISABLED)
+            {
+                cache_period = fill_cache(packet, generator, cache);
+
+                stats::add(counters->cached_packet_count, cache_period);
+            }
 
-            _output->open();
+            // In pipelined mode the packets are rendered ahead by a
+            // producer thread, this thread only takes them from the ring.
 
-            data_size = _generator->size();
-            data = (byte_t*)malloc(data_size);
-            memset(data, 0, data_size);
+            if (_ring_depth != RING_DISABLED && cache_period == 0)
+            {
+                ring = new packet_ring(_ring_depth, data_size);
+
+                producer = new thread_t(
+                    data_dispatcher::producer_proc,
+                    this,
+                    packet,
+                    ring,
+                    counters);
+            }
 
             duration_watch.start();
 
             while (is_running())
             {
-                if (!is_paused() &&
-                    delay_watch.get_time_passed() >= time_to_wait)
+                // The clock is read only once per iteration
+
+                now = monotonic_clock::now();
+
+                if (!is_paused())
+                {
+                    time_left =
+                        time_to_wait - delay_watch.get_time_passed(now);
+                }
+
+                if (is_paused())
                 {
-                    _generator->to_buffer(data, data_size);
-                    _output->send(data, data_size);
+                    flush(output, batch, flushed);
+
+                    wait_for_resume();
+                }
+                else if (time_left > duration_t{ 0 })
+                {
+                    // Queued packets are only held back
+                    // for as long as a spin would take.
+
+                    if (time_left > SPIN_DURATION)
+                    {
+                        flush(output, batch, flushed);
+                    }
+
+                    wait_for_delay(time_left);
+                }
+                else if (ring != NULL && (data = ring->peek()) == NULL)
+                {
+                    // Only count how often the ring ran
+                    // empty, not how long it stayed empty.
+
+                    if (!empty)
+                    {
+                        stats::add(counters->ring_empty_count, 1);
+
+                        empty = true;
+                    }
+
+                    wait_for_ring();
+                }
+                else
+                {
+                    empty = false;
+
+                    if (cache_period > 0)
+                    {
+                        data = cache.data() + (cache_index * data_size);
+                    }
+                    else if (ring == NULL)
+                    {
+                        data = packet->render();
+                    }
 
-                    _stats._byte_count += data_size;
-                    _stats._packet_count += 1;
+                    if (!claim_packet(index, data_size))
+                    {
+                        if (is_limit_final(
+                            output,
+                            batch,
+                            flushed,
+                            counters,
+                            data_size,
+                            failure_count))
+                        {
+                            break;
+                        }
+
+                        continue;
+                    }
+
+                    // The delay is measured from the time the packet
+                    // was due, so that the time it takes to send it
+                    // doesn't lower the rate.
+
+                    if (_delay != NULL || _pacer != NULL)
+                    {
+                        time_to_wait = next_delay(data_size);
+                        delay_watch.start(now);
+                    }
 
-                    _generator->next();
+                    // Outputs with transmit buffers of their own (e.g.
+                    // rings shared with the kernel) get the packet copied
+                    // right into a slot, instead of passing it to send().
+
+                    slot = output->reserve(data_size);
+
+                    if (slot != NULL)
+                    {
+                        memcpy(slot, data, data_size);
+                        output->commit(data_size);
+                    }
+                    else if (_batch_size > 1)
+                    {
+                        slot = batch_buffer.data() + (batch.size() * data_size);
 
-                    if (_delay != NULL)
+                        memcpy(slot, data, data_size);
+                        batch.push_back({ slot, data_size });
+
+                        if (batch.size() == _batch_size)
+                        {
+                            send_batch(output, batch);
+                        }
+                    }
+                    else
+                    {
+                        output->send(data, data_size);
+                    }
+
+                    flushed = false;
+
+                    if (cache_period > 0)
+                    {
+                        if (++cache_index == cache_period)
+                        {
+                            cache_index = 0;
+                        }
+                    }
+                    else if (ring != NULL)
+                    {
+                        ring->release();
+                    }
+                    else
                     {
-                        time_to_wait = _delay->next();
-                        delay_watch.start();
+                        packet->next();
                     }
                 }
 
-                _stats._duration = duration_watch.get_time_passed();
+                count_failures(counters, output, data_size, failure_count);
 
-                stats_changed();
+                // The first worker keeps the clock for all others,
+                // listeners are notified by the reporter thread.
 
-                if (is_limit_reached())
+                if (index == 0)
                 {
-                    limit_reached();
+                    _stats._duration.store(
+                        duration_watch.get_time_passed(now),
+                        std::memory_order_relaxed);
+                }
 
+                if (is_limit_reached() &&
+                    is_limit_final(
+                        output,
+                        batch,
+                        flushed,
+                        counters,
+                        data_size,
+                        failure_count))
+                {
                     break;
                 }
             }
+
+            // Packets of an incomplete batch have already been
+            // counted, so they have to be sent before leaving.
+
+            flush(output, batch, flushed);
+
+            count_failures(counters, output, data_size, failure_count);
         }
         catch (const exception_t& exception)
         {
             thread_exception(exception);
         }
 
-        if (data != NULL)
+        if (producer != NULL)
         {
-            free(data);
+            ring->close();
+            producer->join();
         }
 
-        _output->close();
+        safe_delete(producer);
+        safe_delete(ring);
+        safe_delete(packet);
+
+        output->close();
+
+        if (is_running() &&
+            is_limit_reached() &&
+            !_limit_reached.exchange(true))
+        {
+            limit_reached();
+        }
+
+        // One worker ending, for whatever reason, ends all of them
 
         _state = state::STOPPED;
 
+        wake_workers();
+
     } /* dispatcher_loop */
 
     /*---------------------------------------------------------------------- */
 
+    size_t data_dispatcher::fill_cache(
+        packet_template* packet,
+        data_generator* generator,
+        vector_t<byte_t>& cache)
+    {
+        size_t size = packet->size();
+        size_t period = 0;
+
+        // Generators that repeat within the cache size are rendered
+        // for one period only, which then is replayed over and over.
+
+        period = generator->get_period(_cache_size / size);
+
+        if (period == data_generator::PERIOD_UNKNOWN ||
+            period > _cache_size / size)
+        {
+            return 0;
+        }
+
+        cache.resize(period * size);
+
+        for (size_t i = 0; i < period; i++)
+        {
+            memcpy(cache.data() + (i * size), packet->render(), size);
+
+            packet->next();
+        }
+
+        return period;
+
+    } /* fill_cache */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::reporter_proc(data_dispatcher* dispatcher)
+    {
+        dispatcher->reporter_loop();
+
+    } /* reporter_proc */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::reporter_loop()
+    {
+        // Listeners are notified at a fixed interval from here, so
+        // that it never happens on the packet path of a worker.
+
+        while (is_running())
+        {
+            {
+                std::unique_lock<mutex_t> lock(_state_mutex);
+
+                _state_condition.wait_for(lock, _stats_interval, [this]()
+                {
+                    return _state == state::STOPPED;
+                });
+            }
+
+            stats_changed();
+        }
+
+    } /* reporter_loop */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::producer_proc(
+        data_dispatcher* dispatcher,
+        packet_template* packet,
+        packet_ring* ring,
+        stats::counters* counters)
+    {
+        dispatcher->producer_loop(packet, ring, counters);
+
+    } /* producer_proc */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::producer_loop(
+        packet_template* packet,
+        packet_ring* ring,
+        stats::counters* counters)
+    {
+        byte_t* slot = NULL;
+        bool full = false;
+
+        try
+        {
+            while (!ring->is_closed() && is_running())
+            {
+                if (is_paused())
+                {
+                    wait_for_resume();
+                }
+                else if ((slot = ring->reserve()) == NULL)
+                {
+                    if (!full)
+                    {
+                        stats::add(counters->ring_full_count, 1);
+
+                        full = true;
+                    }
+
+                    wait_for_ring();
+                }
+                else
+                {
+                    full = false;
+
+                    memcpy(slot, packet->render(), ring->get_slot_size());
+                    ring->commit();
+
+                    packet->next();
+                }
+            }
+        }
+        catch (const exception_t& exception)
+        {
+            thread_exception(exception);
+
+            _state = state::STOPPED;
+
+            wake_workers();
+        }
+
+    } /* producer_loop */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::send_batch(
+        data_output* output, vector_t<data_output::span>& batch)
+    {
+        if (!batch.empty())
+        {
+            output->send_batch(batch);
+
+            batch.clear();
+        }
+
+    } /* send_batch */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::flush(
+        data_output* output,
+        vector_t<data_output::span>& batch,
+        bool& flushed)
+    {
+        if (!flushed)
+        {
+            send_batch(output, batch);
+            output->flush();
+
+            flushed = true;
+        }
+
+    } /* flush */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::count_failures(
+        stats::counters* counters,
+        data_output* output,
+        size_t size,
+        size_t& failure_count)
+    {
+        size_t new_failures = output->get_failure_count() - failure_count;
+
+        // Outputs count the packets they failed to send themselves,
+        // only those added since the last call are published here, so
+        // that they show up while the dispatcher is still running.
+
+        if (new_failures > 0)
+        {
+            stats::add(counters->send_failure_count, new_failures);
+
+            // Packets were counted (and claimed against the limits) before
+            // being sent. Dropped ones are taken back, so that the counts
+            // and limits only include packets that were actually sent.
+
+            stats::subtract(counters->packet_count, new_failures);
+            stats::subtract(counters->byte_count, new_failures * size);
+
+            if (_limits != NULL &&
+                (_limits->has_packet_limit() || _limits->has_byte_limit()))
+            {
+                _claimed_packets -= new_failures;
+                _claimed_bytes -= new_failures * size;
+            }
+
+            failure_count += new_failures;
+        }
+
+    } /* count_failures */
+
+    /*---------------------------------------------------------------------- */
+
+    bool data_dispatcher::is_limit_final(
+        data_output* output,
+        vector_t<data_output::span>& batch,
+        bool& flushed,
+        stats::counters* counters,
+        size_t size,
+        size_t& failure_count)
+    {
+        // Packets still queued may fail to be sent and give their claim
+        // back, in which case the limit has not been reached after all.
+
+        flush(output, batch, flushed);
+        count_failures(counters, output, size, failure_count);
+
+        return is_limit_reached();
+
+    } /* is_limit_final */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t data_dispatcher::next_delay(size_t size)
+    {
+        duration_t delay = duration_t{ 0 };
+
+        if (_delay != NULL)
+        {
+            std::lock_guard<mutex_t> lock(_delay_mutex);
+
+            delay = _delay->next();
+        }
+
+        // The pacer is shared by all workers without locking
+
+        if (_pacer != NULL)
+        {
+            delay = std::max(delay, _pacer->consume(size));
+        }
+
+        return delay;
+
+    } /* next_delay */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::wait_for_delay(duration_t time_left)
+    {
+        std::unique_lock<mutex_t> lock(_state_mutex, std::defer_lock);
+        duration_t time_to_sleep = duration_t{ 0 };
+
+        switch (_wait_policy)
+        {
+            case wait_policy::HYBRID:
+                time_to_sleep = time_left - SPIN_DURATION;
+                break;
+
+            case wait_policy::SLEEP:
+                time_to_sleep = time_left;
+                break;
+
+            default:
+                break;
+        }
+
+        if (time_to_sleep <= duration_t{ 0 })
+        {
+            return;
+        }
+
+        // Pausing or stopping ends the wait early
+
+        lock.lock();
+
+        _state_condition.wait_for(lock, time_to_sleep, [this]()
+        {
+            return _state != state::RUNNING;
+        });
+
+    } /* wait_for_delay */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::wait_for_resume()
+    {
+        std::unique_lock<mutex_t> lock(_state_mutex);
+
+        // Wakes up regularly, so that the duration
+        // keeps counting while being paused.
+
+        _state_condition.wait_for(lock, PAUSE_TIMEOUT, [this]()
+        {
+            return _state != state::PAUSED;
+        });
+
+    } /* wait_for_resume */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::wait_for_ring()
+    {
+        // The other side of the ring is usually only a
+        // few packets away, so this never goes to sleep.
+
+        if (_wait_policy != wait_policy::BUSY_POLL)
+        {
+            std::this_thread::yield();
+        }
+
+    } /* wait_for_ring */
+
+    /*---------------------------------------------------------------------- */
+
+    bool data_dispatcher::claim_packet(size_t index, size_t size)
+    {
+        stats::counters* counters = _stats.counters_at(index);
+        size_t packet_count = 0;
+        size_t byte_count = 0;
+
+        // Counters are claimed before sending, so that concurrent
+        // workers can never exceed a limit. As before, the byte limit
+        // is reached by the first packet that crosses it. Without such
+        // limits, workers don't have to share anything at all.
+
+        if (_limits != NULL &&
+            (_limits->has_packet_limit() || _limits->has_byte_limit()))
+        {
+            packet_count = _claimed_packets.fetch_add(1);
+            byte_count = _claimed_bytes.fetch_add(size);
+
+            if ((_limits->has_packet_limit() &&
+                 packet_count >= _limits->get_packet_limit()) ||
+                (_limits->has_byte_limit() &&
+                 byte_count >= _limits->get_byte_limit()))
+            {
+                _claimed_packets -= 1;
+                _claimed_bytes -= size;
+
+                return false;
+            }
+        }
+
+        stats::add(counters->packet_count, 1);
+        stats::add(counters->byte_count, size);
+
+        return true;
+
+    } /* claim_packet */
+
+    /*---------------------------------------------------------------------- */
+
     bool data_dispatcher::is_limit_reached() const
     {
         if (_limits != NULL)
         {
             return
                 (_limits->has_byte_limit() &&
-                 _stats._byte_count >= _limits->get_byte_limit()) ||
+                 _claimed_bytes >= _limits->get_byte_limit()) ||
                 (_limits->has_packet_limit() &&
-                 _stats._packet_count >= _limits->get_packet_limit()) ||
+                 _claimed_packets >= _limits->get_packet_limit()) ||
                 (_limits->has_duration_limit() &&
-                 _stats._duration >= _limits->get_duration_limit());
+                 _stats.get_duration() >= _limits->get_duration_limit());
         }
 
         return false;
@@ -287,6 +1001,8 @@ namespace hyenae::model
 
     void data_dispatcher::limit_reached()
     {
+        std::lock_guard<mutex_t> lock(_listener_mutex);
+
         listeners([](auto listener)
         {
             listener->on_limit_reached();
@@ -298,7 +1014,12 @@ namespace hyenae::model
 
     void data_dispatcher::thread_exception(const exception_t& exception)
     {
-        listeners([exception](auto listener)
+        std::lock_guard<mutex_t> lock(_listener_mutex);
+
+        // Captured by reference, a copy would only
+        // keep the base class and lose the message.
+
+        listeners([&exception](auto listener)
             {
                 listener->on_thread_exception(exception);
             });
@@ -24,25 +24,118 @@
  *
  */
 
+#include "../../include/assert.h"
 #include "../../include/model/data_dispatcher.h"
 
-#include <cstring>
-
 namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
 
     data_dispatcher::stats::stats()
     {
-        reset();
+        init(1);
 
     } /* stats */
 
     /*---------------------------------------------------------------------- */
 
+    data_dispatcher::stats::~stats()
+    {
+        safe_delete(_counters);
+
+    } /* ~stats */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::stats::init(size_t worker_count)
+    {
+        safe_delete(_counters);
+
+        _counters.clear();
+
+        for (size_t i = 0; i < worker_count; i++)
+        {
+            _counters.push_back(new counters());
+        }
+
+        reset();
+
+    } /* init */
+
+    /*---------------------------------------------------------------------- */
+
+    data_dispatcher::stats::counters* data_dispatcher::stats::counters_at(
+        size_t index)
+    {
+        assert::in_range(index < _counters.size(), "index");
+
+        return _counters[index];
+
+    } /* counters_at */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::stats::add(atomic_t<size_t>& counter, size_t value)
+    {
+        // There is only one writer per counter, so a relaxed load and
+        // store is enough and cheaper than a locked read-modify-write.
+
+        counter.store(
+            counter.load(std::memory_order_relaxed) + value,
+            std::memory_order_relaxed);
+
+    } /* add */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_dispatcher::stats::subtract(
+        atomic_t<size_t>& counter, size_t value)
+    {
+        counter.store(
+            counter.load(std::memory_order_relaxed) - value,
+            std::memory_order_relaxed);
+
+    } /* subtract */
+
+    /*---------------------------------------------------------------------- */
+
+    data_dispatcher::stats::snapshot
+        data_dispatcher::stats::get_snapshot() const
+    {
+        snapshot snapshot = {};
+
+        for (auto counters : _counters)
+        {
+            snapshot.byte_count +=
+                counters->byte_count.load(std::memory_order_relaxed);
+
+            snapshot.packet_count +=
+                counters->packet_count.load(std::memory_order_relaxed);
+
+            snapshot.ring_full_count +=
+                counters->ring_full_count.load(std::memory_order_relaxed);
+
+            snapshot.ring_empty_count +=
+                counters->ring_empty_count.load(std::memory_order_relaxed);
+
+            snapshot.cached_packet_count +=
+                counters->cached_packet_count.load(std::memory_order_relaxed);
+
+            snapshot.send_failure_count +=
+                counters->send_failure_count.load(std::memory_order_relaxed);
+        }
+
+        snapshot.duration = _duration.load(std::memory_order_relaxed);
+
+        return snapshot;
+
+    } /* get_snapshot */
+
+    /*---------------------------------------------------------------------- */
+
     size_t data_dispatcher::stats::get_byte_count() const
     {
-        return _byte_count;
+        return get_snapshot().byte_count;
 
     } /* get_byte_count */
 
@@ -50,7 +143,7 @@ namespace hyenae::model
 
     size_t data_dispatcher::stats::get_packet_count() const
     {
-        return _packet_count;
+        return get_snapshot().packet_count;
 
     } /* get_packet_count */
 
@@ -58,15 +151,57 @@ namespace hyenae::model
 
     duration_t data_dispatcher::stats::get_duration() const
     {
-        return _duration;
+        return _duration.load(std::memory_order_relaxed);
 
     } /* get_duration */
 
     /*---------------------------------------------------------------------- */
 
+    size_t data_dispatcher::stats::get_ring_full_count() const
+    {
+        return get_snapshot().ring_full_count;
+
+    } /* get_ring_full_count */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_dispatcher::stats::get_ring_empty_count() const
+    {
+        return get_snapshot().ring_empty_count;
+
+    } /* get_ring_empty_count */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_dispatcher::stats::get_cached_packet_count() const
+    {
+        return get_snapshot().cached_packet_count;
+
+    } /* get_cached_packet_count */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_dispatcher::stats::get_send_failure_count() const
+    {
+        return get_snapshot().send_failure_count;
+
+    } /* get_send_failure_count */
+
+    /*---------------------------------------------------------------------- */
+
     void data_dispatcher::stats::reset()
     {
-        memset(this, 0, sizeof(stats));
+        for (auto counters : _counters)
+        {
+            counters->byte_count = 0;
+            counters->packet_count = 0;
+            counters->ring_full_count = 0;
+            counters->ring_empty_count = 0;
+            counters->cached_packet_count = 0;
+            counters->send_failure_count = 0;
+        }
+
+        _duration = duration_t{ 0 };
 
     } /* reset */
 
@@ -26,11 +26,25 @@
 
 #include "../../include/assert.h"
 #include "../../include/model/data_generator.h"
+#include "../../include/model/generator_group.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
 
+    data_generator* data_generator::clone() const
+    {
+        clone_map_t clones;
+
+        return create_clone(clones);
+
+    } /* clone */
+
+    /*---------------------------------------------------------------------- */
+
     size_t data_generator::transformation_count() const
     {
         return _transformations.size();
@@ -57,6 +71,8 @@ namespace hyenae::model
 
         _transformations.push_back(transformation);
 
+        layout_changed();
+
     } /* add_transformation */
 
     /*---------------------------------------------------------------------- */
@@ -67,20 +83,32 @@ namespace hyenae::model
 
         _transformations.erase(_transformations.begin() + pos);
 
+        layout_changed();
+
     } /* remove_transformation_at */
 
     /*---------------------------------------------------------------------- */
 
     size_t data_generator::size() const
     {
-        size_t size = data_size();
+        // The size of generators only changes with their layout (e.g. a
+        // payload being added), which is reported by layout_changed(). It
+        // is therefore only computed once, instead of walking the whole
+        // tree below for every packet.
 
-        for (auto transformation : _transformations)
+        if (!_size_known)
         {
-            size = transformation->result_size(size);
+            _size = data_size();
+
+            for (auto transformation : _transformations)
+            {
+                _size = transformation->result_size(_size);
+            }
+
+            _size_known = true;
         }
 
-        return size;
+        return _size;
 
     } /* size */
 
@@ -89,23 +117,49 @@ namespace hyenae::model
     byte_t* data_generator::to_buffer(byte_t* buffer, size_t size) const
     {
         size_t result_size = 0;
-        byte_t* result = NULL;
+        size_t max_size = 0;
+        byte_t* result = buffer;
 
         assert::argument_not_null(buffer, "buffer");
         assert::no_overflow(size >= this->size());
 
         result_size = data_size();
-        result = (byte_t*)malloc(result_size);
+        max_size = result_size;
+
+        for (auto transformation : _transformations)
+        {
+            result_size = transformation->result_size(result_size);
+            max_size = std::max(max_size, result_size);
+        }
+
+        // Transformations run in place. Only if an intermediate result
+        // doesn't fit into the given buffer (e.g. data reduced to a
+        // checksum), a buffer kept by the generator is used instead,
+        // which only has to grow on the first call.
+
+        if (max_size > size)
+        {
+            if (_transformation_buffer.size() < max_size)
+            {
+                _transformation_buffer.resize(max_size);
+            }
+
+            result = _transformation_buffer.data();
+        }
+
+        result_size = data_size();
         data_to_buffer(result, result_size);
 
         for (auto transformation : _transformations)
         {
-            result = transformation->transform(result, result_size);
+            transformation->transform(result, result_size, result);
             result_size = transformation->result_size(result_size);
         }
 
-        memcpy(buffer, result, result_size);
-        free(result);
+        if (result != buffer)
+        {
+            memcpy(buffer, result, result_size);
+        }
 
         return buffer;
 
@@ -113,6 +167,67 @@ namespace hyenae::model
 
     /*---------------------------------------------------------------------- */
 
+    bool data_generator::render_batch(
+        byte_t* buffer, size_t stride, size_t count, size_t step) const
+    {
+        // Renders the current data and the count - 1 that follow it, each
+        // step calls of next() apart, into slots of the given stride. The
+        // generator itself is not advanced. Only generators that can tell
+        // their data ahead of next() support this, all others return false
+        // without rendering anything.
+
+        return false;
+
+    } /* render_batch */
+
+    /*---------------------------------------------------------------------- */
+
+    bool data_generator::is_constant() const
+    {
+        // Unless told otherwise, we have to assume that
+        // every call of next() may change the data.
+
+        return false;
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* data_generator::get_layout() const
+    {
+        return NULL;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t data_generator::get_period(size_t max_period) const
+    {
+        const generator_group* layout = NULL;
+
+        // Returns the number of calls of next() after which the data
+        // repeats, as long as it doesn't exceed the given max period.
+
+        if (is_constant())
+        {
+            return 1;
+        }
+
+        // Generators with a layout are just as periodic as its parts
+
+        layout = get_layout();
+
+        if (layout != NULL && layout != this)
+        {
+            return layout->get_period(max_period);
+        }
+
+        return PERIOD_UNKNOWN;
+
+    } /* get_period */
+
+    /*---------------------------------------------------------------------- */
+
     void data_generator::data_changed()
     {
         listeners([](auto listener)
@@ -124,4 +239,63 @@ namespace hyenae::model
 
     /*---------------------------------------------------------------------- */
 
+    void data_generator::layout_changed()
+    {
+        // Groups containing this generator cache their size as well,
+        // they are told through the same path as for changed data.
+
+        _size_known = false;
+
+        data_changed();
+
+    } /* layout_changed */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_generator::on_data_changed()
+    {
+        // Only called for generators listening to parts of their own.
+        // Frames listen to their packet, whose size changes when a
+        // payload is added or removed, so their cached size has to be
+        // dropped along with it.
+
+        layout_changed();
+
+    } /* on_data_changed */
+
+    /*---------------------------------------------------------------------- */
+
+    void data_generator::clone_transformations(data_generator* clone) const
+    {
+        // Transformations are stateless and owned by whoever created them,
+        // so the clone can simply share them with the original.
+
+        for (auto transformation : _transformations)
+        {
+            clone->add_transformation(transformation);
+        }
+
+    } /* clone_transformations */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* data_generator::clone_of(
+        const data_generator* generator, clone_map_t& clones)
+    {
+        auto pos = clones.find(generator);
+
+        if (pos != clones.end())
+        {
+            // Generator is shared within the cloned tree (e.g. a pseudo
+            // header) and has already been cloned by it's owner.
+
+            return pos->second;
+        }
+
+        return generator->create_clone(clones);
+
+    } /* clone_of */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model */
@@ -27,17 +27,199 @@
 #include "../../../include/assert.h"
 #include "../../../include/model/data_transformation/to_crc32_checksum.h"
 
-#include <cstdlib>
 #include <cstring>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define HAVE_CLMUL_KERNEL
+    #include <immintrin.h>
+#endif
+
 namespace hyenae::model::data_transformations
 {
     /*---------------------------------------------------------------------- */
 
+#ifdef HAVE_CLMUL_KERNEL
+
+    // Folding needs at least four 16 byte blocks to start with
+
+    const size_t CLMUL_MIN_SIZE = 64;
+
+    /*---------------------------------------------------------------------- */
+
+    // Folds 16 byte blocks by carry-less multiplication and reduces the
+    // rest with a Barrett reduction, as described in Intel's "Fast CRC
+    // Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+    // The constants only apply to the Ethernet polynomial. The size must
+    // be a multiple of 16 and at least CLMUL_MIN_SIZE.
+
+    __attribute__((target("pclmul,sse4.1")))
+    static uint32_t clmul_kernel(
+        uint32_t crc, const byte_t* data, size_t size)
+    {
+        alignas(16) static const uint64_t k1k2[] =
+            { 0x0154442bd4, 0x01c6e41596 };
+
+        alignas(16) static const uint64_t k3k4[] =
+            { 0x01751997d0, 0x00ccaa009e };
+
+        alignas(16) static const uint64_t k5k0[] =
+            { 0x0163cd6124, 0x0000000000 };
+
+        alignas(16) static const uint64_t poly[] =
+            { 0x01db710641, 0x01f7011641 };
+
+        __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+        x1 = _mm_loadu_si128((const __m128i*) (data + 0x00));
+        x2 = _mm_loadu_si128((const __m128i*) (data + 0x10));
+        x3 = _mm_loadu_si128((const __m128i*) (data + 0x20));
+        x4 = _mm_loadu_si128((const __m128i*) (data + 0x30));
+
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int) crc));
+
+        x0 = _mm_load_si128((const __m128i*) k1k2);
+
+        data += 64;
+        size -= 64;
+
+        // Fold by four blocks
+
+        while (size >= 64)
+        {
+            x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+            x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+            x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+            x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+            x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+                _mm_loadu_si128((const __m128i*) (data + 0x00)));
+
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+                _mm_loadu_si128((const __m128i*) (data + 0x10)));
+
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+                _mm_loadu_si128((const __m128i*) (data + 0x20)));
+
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+                _mm_loadu_si128((const __m128i*) (data + 0x30)));
+
+            data += 64;
+            size -= 64;
+        }
+
+        // Fold the four blocks into one
+
+        x0 = _mm_load_si128((const __m128i*) k3k4);
+
+        for (__m128i block : { x2, x3, x4 })
+        {
+            x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, block), x5);
+        }
+
+        // Fold remaining single blocks
+
+        while (size >= 16)
+        {
+            x2 = _mm_loadu_si128((const __m128i*) data);
+
+            x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+            data += 16;
+            size -= 16;
+        }
+
+        // Fold 128 into 64 bits
+
+        x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+        x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+        x1 = _mm_srli_si128(x1, 8);
+        x1 = _mm_xor_si128(x1, x2);
+
+        x0 = _mm_loadl_epi64((const __m128i*) k5k0);
+
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_and_si128(x1, x3);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        // Barrett reduction to 32 bits
+
+        x0 = _mm_load_si128((const __m128i*) poly);
+
+        x2 = _mm_and_si128(x1, x3);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+        x2 = _mm_and_si128(x2, x3);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        return (uint32_t) _mm_extract_epi32(x1, 1);
+
+    } /* clmul_kernel */
+
+    /*---------------------------------------------------------------------- */
+
+    static bool has_clmul()
+    {
+        __builtin_cpu_init();
+
+        return
+            __builtin_cpu_supports("pclmul") &&
+            __builtin_cpu_supports("sse4.1");
+
+    } /* has_clmul */
+
+#endif /* HAVE_CLMUL_KERNEL */
+
+    /*---------------------------------------------------------------------- */
+
     to_crc32_checksum::to_crc32_checksum(uint32_t polynomial)
     {
+        uint32_t crc = 0;
+
         _polynomial = polynomial;
 
+        // The first table holds the bitwise CRC of every byte value,
+        // each further table advances an entry by one more zero byte.
+
+        for (uint32_t value = 0; value < 256; value++)
+        {
+            crc = value;
+
+            for (uint32_t i = 0; i < 8; i++)
+            {
+                if (crc & 1)
+                {
+                    crc = (crc >> 1) ^ _polynomial;
+                }
+                else
+                {
+                    crc = crc >> 1;
+                }
+            }
+
+            _table[0][value] = crc;
+        }
+
+        for (size_t slice = 1; slice < SLICES; slice++)
+        {
+            for (uint32_t value = 0; value < 256; value++)
+            {
+                crc = _table[slice - 1][value];
+
+                _table[slice][value] =
+                    (crc >> 8) ^ _table[0][crc & 0xFF];
+            }
+        }
+
     } /* to_crc32_checksum */
 
     /*---------------------------------------------------------------------- */
@@ -50,49 +232,41 @@ namespace hyenae::model::data_transformations
 
     /*---------------------------------------------------------------------- */
 
-    byte_t* to_crc32_checksum::transform(byte_t* data, size_t size) const
+    void to_crc32_checksum::transform(
+        const byte_t* data, size_t size, byte_t* result) const
     {
-        byte_t* result = NULL;
-        size_t result_size = 0;
         uint32_t checksum = 0;
 
         assert::argument_not_null(data, "data");
+        assert::argument_not_null(result, "result");
 
         checksum = this->checksum(data, size);
-        result_size = this->result_size(size);
-        
-        result = (byte_t*) malloc(result_size);
-        memset(result, 0, result_size);
-        memcpy(result, &checksum, result_size);
-
-        free(data);
 
-        return result;
+        memcpy(result, &checksum, sizeof(checksum));
 
     } /* transform */
 
     /*---------------------------------------------------------------------- */
 
-    uint32_t to_crc32_checksum::checksum(byte_t* data, size_t size) const
+    uint32_t to_crc32_checksum::checksum(
+        const byte_t* data, size_t size) const
     {
         uint32_t result = 0xFFFFFFFF;
+        size_t folded = 0;
 
-        for (size_t pos = 0; pos < size; pos++)
+#ifdef HAVE_CLMUL_KERNEL
+        static const bool clmul = has_clmul();
+
+        if (clmul &&
+            _polynomial == POLYNOMIAL_ETHERNET &&
+            size >= CLMUL_MIN_SIZE)
         {
-            result ^= *((uint8_t*)(data + pos));
+            folded = size & ~(size_t) 15;
 
-            for (uint32_t i = 0; i < 8; i++)
-            {
-                if (result & 1)
-                {
-                    result = (result >> 1) ^ _polynomial;
-                }
-                else
-                {
-                    result = result >> 1;
-                }
-            }
+            result = clmul_kernel(result, data, folded);
         }
+#endif
+        result = update_crc(result, data + folded, size - folded);
 
         return ~result;
 
@@ -100,4 +274,56 @@ namespace hyenae::model::data_transformations
 
     /*---------------------------------------------------------------------- */
 
+    uint32_t to_crc32_checksum::update_crc(
+        uint32_t crc, const byte_t* data, size_t size) const
+    {
+        const uint8_t* bytes = (const uint8_t*) data;
+        uint32_t low = 0;
+        uint32_t high = 0;
+
+        // Slicing-by-8, bytes are assembled explicitly
+        // so that this works regardless of endianess.
+
+        while (size >= SLICES)
+        {
+            low = crc ^
+                ((uint32_t) bytes[0] |
+                ((uint32_t) bytes[1] << 8) |
+                ((uint32_t) bytes[2] << 16) |
+                ((uint32_t) bytes[3] << 24));
+
+            high =
+                (uint32_t) bytes[4] |
+                ((uint32_t) bytes[5] << 8) |
+                ((uint32_t) bytes[6] << 16) |
+                ((uint32_t) bytes[7] << 24);
+
+            crc =
+                _table[7][low & 0xFF] ^
+                _table[6][(low >> 8) & 0xFF] ^
+                _table[5][(low >> 16) & 0xFF] ^
+                _table[4][low >> 24] ^
+                _table[3][high & 0xFF] ^
+                _table[2][(high >> 8) & 0xFF] ^
+                _table[1][(high >> 16) & 0xFF] ^
+                _table[0][high >> 24];
+
+            bytes += SLICES;
+            size -= SLICES;
+        }
+
+        while (size > 0)
+        {
+            crc = (crc >> 8) ^ _table[0][(crc ^ *bytes) & 0xFF];
+
+            bytes++;
+            size--;
+        }
+
+        return crc;
+
+    } /* update_crc */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::data_transformations */
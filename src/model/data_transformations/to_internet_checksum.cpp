@@ -29,10 +29,172 @@
 
 #include <cstring>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define HAVE_X86_KERNELS
+    #include <immintrin.h>
+#endif
+
 namespace hyenae::model::data_transformations
 {
     /*---------------------------------------------------------------------- */
 
+    using kernel_t = uint64_t (*)(const byte_t* data, size_t size);
+
+    /*---------------------------------------------------------------------- */
+
+    // Adds with end-around carry, which keeps a 64-bit sum equivalent
+    // to the ones' complement sum of its 16-bit words (RFC 1071).
+
+    static inline uint64_t add_carry(uint64_t sum, uint64_t value)
+    {
+        sum += value;
+
+        return sum + (sum < value);
+
+    } /* add_carry */
+
+    /*---------------------------------------------------------------------- */
+
+    static uint64_t portable_kernel(const byte_t* data, size_t size)
+    {
+        uint64_t sum = 0;
+        uint64_t value = 0;
+        size_t pos = 0;
+
+        for (pos = 0; pos + sizeof(value) <= size; pos += sizeof(value))
+        {
+            memcpy(&value, data + pos, sizeof(value));
+            sum = add_carry(sum, value);
+        }
+
+        // The remaining bytes keep their position within the
+        // word, a missing last byte is treated as zero.
+
+        if (pos < size)
+        {
+            value = 0;
+            memcpy(&value, data + pos, size - pos);
+            sum = add_carry(sum, value);
+        }
+
+        return sum;
+
+    } /* portable_kernel */
+
+    /*---------------------------------------------------------------------- */
+
+#ifdef HAVE_X86_KERNELS
+
+    // The SIMD kernels widen the 16-bit words into 32-bit lanes. Each
+    // step adds at most 0x1FFFE to a lane, so the lanes are folded into
+    // the 64-bit sum before they could overflow.
+
+    const size_t MAX_LANE_STEPS = 0x8000;
+
+    /*---------------------------------------------------------------------- */
+
+    __attribute__((target("sse2")))
+    static uint64_t sse2_kernel(const byte_t* data, size_t size)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lanes = zero;
+        __m128i block = zero;
+        uint32_t values[4];
+        uint64_t sum = 0;
+        size_t steps = 0;
+        size_t pos = 0;
+
+        for (pos = 0; pos + sizeof(block) <= size; pos += sizeof(block))
+        {
+            block = _mm_loadu_si128((const __m128i*) (data + pos));
+
+            lanes = _mm_add_epi32(lanes, _mm_unpacklo_epi16(block, zero));
+            lanes = _mm_add_epi32(lanes, _mm_unpackhi_epi16(block, zero));
+
+            if (++steps == MAX_LANE_STEPS || pos + 2 * sizeof(block) > size)
+            {
+                _mm_storeu_si128((__m128i*) values, lanes);
+
+                for (auto value : values)
+                {
+                    sum += value;
+                }
+
+                lanes = zero;
+                steps = 0;
+            }
+        }
+
+        return add_carry(sum, portable_kernel(data + pos, size - pos));
+
+    } /* sse2_kernel */
+
+    /*---------------------------------------------------------------------- */
+
+    __attribute__((target("avx2")))
+    static uint64_t avx2_kernel(const byte_t* data, size_t size)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i lanes = zero;
+        __m256i block = zero;
+        uint32_t values[8];
+        uint64_t sum = 0;
+        size_t steps = 0;
+        size_t pos = 0;
+
+        for (pos = 0; pos + sizeof(block) <= size; pos += sizeof(block))
+        {
+            block = _mm256_loadu_si256((const __m256i*) (data + pos));
+
+            lanes = _mm256_add_epi32(
+                lanes, _mm256_unpacklo_epi16(block, zero));
+
+            lanes = _mm256_add_epi32(
+                lanes, _mm256_unpackhi_epi16(block, zero));
+
+            if (++steps == MAX_LANE_STEPS || pos + 2 * sizeof(block) > size)
+            {
+                _mm256_storeu_si256((__m256i*) values, lanes);
+
+                for (auto value : values)
+                {
+                    sum += value;
+                }
+
+                lanes = zero;
+                steps = 0;
+            }
+        }
+
+        return add_carry(sum, portable_kernel(data + pos, size - pos));
+
+    } /* avx2_kernel */
+
+#endif /* HAVE_X86_KERNELS */
+
+    /*---------------------------------------------------------------------- */
+
+    static kernel_t select_kernel()
+    {
+#ifdef HAVE_X86_KERNELS
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return avx2_kernel;
+        }
+
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return sse2_kernel;
+        }
+#endif
+        return portable_kernel;
+
+    } /* select_kernel */
+
+    /*---------------------------------------------------------------------- */
+
     to_internet_checksum* to_internet_checksum::_instance = NULL;
 
     /*---------------------------------------------------------------------- */
@@ -58,44 +220,101 @@ namespace hyenae::model::data_transformations
 
     /*---------------------------------------------------------------------- */
 
-    byte_t* to_internet_checksum::transform(byte_t* data, size_t size) const
+    void to_internet_checksum::transform(
+        const byte_t* data, size_t size, byte_t* result) const
     {
-        byte_t* result = NULL;
-        size_t result_size = 0;
         uint16_t checksum = 0;
 
         assert::argument_not_null(data, "data");
+        assert::argument_not_null(result, "result");
 
-        checksum = this->checksum(data, size);
-        result_size = this->result_size(size);
-
-        result = (byte_t*)malloc(result_size);
-        memset(result, 0, result_size);
-        memcpy(result, &checksum, result_size);
+        // Result may alias the data, so it is written
+        // only after the checksum has been calculated.
 
-        free(data);
+        checksum = ~sum(data, size);
 
-        return result;
+        memcpy(result, &checksum, sizeof(checksum));
 
     } /* transform */
 
     /*---------------------------------------------------------------------- */
 
-    uint16_t to_internet_checksum::checksum(byte_t* data, size_t size) const
+    bool to_internet_checksum::is_incremental() const
+    {
+        return true;
+
+    } /* is_incremental */
+
+    /*---------------------------------------------------------------------- */
+
+    void to_internet_checksum::update(
+        byte_t* result,
+        const byte_t* old_data,
+        const byte_t* new_data,
+        size_t size,
+        size_t offset) const
+    {
+        uint16_t checksum = 0;
+        bool odd_offset = (offset % 2) != 0;
+
+        assert::argument_not_null(result, "result");
+        assert::argument_not_null(old_data, "old_data");
+        assert::argument_not_null(new_data, "new_data");
+
+        memcpy(&checksum, result, sizeof(checksum));
+
+        checksum = adjust(
+            checksum,
+            sum(old_data, size, odd_offset),
+            sum(new_data, size, odd_offset));
+
+        memcpy(result, &checksum, sizeof(checksum));
+
+    } /* update */
+
+    /*---------------------------------------------------------------------- */
+
+    uint16_t to_internet_checksum::sum(
+        const byte_t* data, size_t size, bool odd_offset)
     {
-        unsigned long sum = 0;
-        uint16_t* tmp = (uint16_t*) data;
+        static const kernel_t kernel = select_kernel();
+        uint64_t sum = 0;
+
+        // Words are summed up in host byte order, which gives the same
+        // result as in network byte order once swapped back (RFC 1071).
 
-        for (int i = size; i > 1; i -= 2)
+        sum = kernel(data, size);
+
+        while (sum >> 16)
         {
-            sum += *tmp++;
+            sum = (sum & 0xFFFF) + (sum >> 16);
+        }
 
-            if (sum & 0x80000000)
-            {
-                sum = (sum & 0xFFFF) + (sum >> 16);
-            }
+        // Data starting at an odd offset of the checksummed
+        // data contributes with swapped bytes.
+
+        if (odd_offset)
+        {
+            sum = ((sum & 0xFF) << 8) | (sum >> 8);
         }
 
+        return (uint16_t) sum;
+
+    } /* sum */
+
+    /*---------------------------------------------------------------------- */
+
+    uint16_t to_internet_checksum::adjust(
+        uint16_t checksum, uint16_t old_sum, uint16_t new_sum)
+    {
+        uint32_t sum = 0;
+
+        // HC' = ~(~HC + ~m + m') as of RFC 1624, eqn. 3
+
+        sum = (uint16_t) ~checksum;
+        sum += (uint16_t) ~old_sum;
+        sum += new_sum;
+
         while (sum >> 16)
         {
             sum = (sum & 0xFFFF) + (sum >> 16);
@@ -103,7 +322,7 @@ namespace hyenae::model::data_transformations
 
         return (uint16_t) ~sum;
 
-    } /* checksum */
+    } /* adjust */
 
     /*---------------------------------------------------------------------- */
 
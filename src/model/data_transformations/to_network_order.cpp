@@ -28,6 +28,8 @@
 #include "../../../include/assert.h"
 #include "../../../include/model/data_transformation/to_network_order.h"
 
+#include <cstring>
+
 namespace hyenae::model::data_transformations
 {
     /*---------------------------------------------------------------------- */
@@ -49,17 +51,21 @@ namespace hyenae::model::data_transformations
 
     /*---------------------------------------------------------------------- */
 
-    byte_t* to_network_order::transform(byte_t* data, size_t size) const
+    void to_network_order::transform(
+        const byte_t* data, size_t size, byte_t* result) const
     {
         assert::known_endianess();
         assert::argument_not_null(data, "data");
+        assert::argument_not_null(result, "result");
 
         if (endian::is_little_endian())
         {
-            return to_reverse_order::transform(data, size);
+            to_reverse_order::transform(data, size, result);
+        }
+        else if (data != result)
+        {
+            memmove(result, data, size);
         }
-
-        return data;
 
     } /* transform */
 
@@ -58,13 +58,20 @@ namespace hyenae::model::data_transformations
 
     /*---------------------------------------------------------------------- */
 
-    byte_t* to_reverse_order::transform(byte_t* data, size_t size) const
+    void to_reverse_order::transform(
+        const byte_t* data, size_t size, byte_t* result) const
     {
         assert::argument_not_null(data, "data");
+        assert::argument_not_null(result, "result");
 
-        std::reverse(data, data + size);
-
-        return data;
+        if (data == result)
+        {
+            std::reverse(result, result + size);
+        }
+        else
+        {
+            std::reverse_copy(data, data + size, result);
+        }
 
     } /* transform */
 
@@ -28,11 +28,21 @@
 #include "../../include/model/generator_group.h"
 
 #include <cstdlib>
+#include <numeric>
+#include <algorithm>
 
 namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
 
+    generator_group::~generator_group()
+    {
+        safe_delete(_owned_generators);
+
+    } /* ~generator_group */
+
+    /*---------------------------------------------------------------------- */
+
     size_t generator_group::generator_count() const
     {
         return _generators.size();
@@ -54,26 +64,52 @@ namespace hyenae::model
         _generators.push_back(generator);
         generator->add_listener(this);
 
+        layout_changed();
+
     } /* add_generator */
 
     /*---------------------------------------------------------------------- */
 
+    void generator_group::adopt_generator(data_generator* generator)
+    {
+        assert::argument_not_null(generator, "generator");
+
+        add_generator(generator);
+        _owned_generators.push_back(generator);
+
+    } /* adopt_generator */
+
+    /*---------------------------------------------------------------------- */
+
     void generator_group::remove_generator_at(const size_t pos)
     {
         assert::in_range(pos < _generators.size(), "pos");
 
         _generators[pos]->remove_listener(this);
+
+        _owned_generators.erase(
+            std::remove(
+                _owned_generators.begin(),
+                _owned_generators.end(),
+                _generators[pos]),
+            _owned_generators.end());
+
         _generators.erase(_generators.begin() + pos);
 
+        layout_changed();
+
     } /* remove_generator_at */
 
     /*---------------------------------------------------------------------- */
 
-    void generator_group::next(bool data_changed)
+    void generator_group::next(bool data_changed, size_t stride)
     {
-        for (auto generator : _generators)
+        // Constant generators have nothing to advance, so only those
+        // that can change at all are visited for every packet.
+
+        for (auto generator : get_varying_generators())
         {
-            generator->next(false);
+            generator->next(false, stride);
         }
 
         if (data_changed)
@@ -101,6 +137,79 @@ namespace hyenae::model
 
     /*---------------------------------------------------------------------- */
 
+    bool generator_group::is_constant() const
+    {
+        return get_varying_generators().empty();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* generator_group::get_layout() const
+    {
+        return this;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t generator_group::get_period(size_t max_period) const
+    {
+        size_t period = 1;
+        size_t generator_period = 0;
+        size_t factor = 0;
+
+        // All generators advance together, so the group
+        // repeats after the least common multiple.
+
+        for (auto generator : _generators)
+        {
+            generator_period = generator->get_period(max_period);
+
+            if (generator_period == PERIOD_UNKNOWN)
+            {
+                return PERIOD_UNKNOWN;
+            }
+
+            factor = generator_period / std::gcd(period, generator_period);
+
+            if (period > max_period / factor)
+            {
+                return PERIOD_UNKNOWN;
+            }
+
+            period *= factor;
+        }
+
+        return period;
+
+    } /* get_period */
+
+    /*---------------------------------------------------------------------- */
+
+    void generator_group::clone_generators(
+        generator_group* group, clone_map_t& clones) const
+    {
+        assert::argument_not_null(group, "group");
+
+        for (auto generator : _generators)
+        {
+            if (clones.find(generator) != clones.end())
+            {
+                // Already cloned and owned by another part of the tree
+
+                group->add_generator(clones[generator]);
+            }
+            else
+            {
+                group->adopt_generator(clone_of(generator, clones));
+            }
+        }
+
+    } /* clone_generators */
+
+    /*---------------------------------------------------------------------- */
+
     size_t generator_group::data_size() const
     {
         size_t size = 0;
@@ -138,11 +247,55 @@ namespace hyenae::model
 
     /*---------------------------------------------------------------------- */
 
-    void generator_group::on_data_changed()
+    data_generator* generator_group::create_clone(clone_map_t& clones) const
     {
-        data_changed();
+        generator_group* clone = new generator_group();
+
+        clones[this] = clone;
+
+        clone_generators(clone, clones);
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
+    void generator_group::layout_changed()
+    {
+        // Generators can only become constant or varying along with
+        // the layout (e.g. a payload being replaced).
+
+        _varying_known = false;
+
+        data_generator::layout_changed();
+
+    } /* layout_changed */
+
+    /*---------------------------------------------------------------------- */
+
+    const vector_t<data_generator*>&
+        generator_group::get_varying_generators() const
+    {
+        if (!_varying_known)
+        {
+            _varying_generators.clear();
+
+            for (auto generator : _generators)
+            {
+                if (!generator->is_constant())
+                {
+                    _varying_generators.push_back(generator);
+                }
+            }
+
+            _varying_known = true;
+        }
+
+        return _varying_generators;
 
-    } /* on_data_changed */
+    } /* get_varying_generators */
 
     /*---------------------------------------------------------------------- */
 
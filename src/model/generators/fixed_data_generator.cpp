@@ -214,6 +214,27 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
+    bool fixed_data_generator::is_constant() const
+    {
+        return _constant;
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    void fixed_data_generator::set_constant(bool constant)
+    {
+        // Data is constant as long as only it's size
+        // based owner updates it (e.g. length fields).
+
+        _constant = constant;
+
+        layout_changed();
+
+    } /* set_constant */
+
+    /*---------------------------------------------------------------------- */
+
     size_t fixed_data_generator::data_size() const
     {
         return _size;
@@ -236,4 +257,19 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
+    data_generator* fixed_data_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        fixed_data_generator* clone = allocate(_size);
+
+        memcpy(clone->_data, _data, _size);
+        clone->_constant = _constant;
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators */
@@ -28,9 +28,8 @@
 #include "../../../include/model/generators/integer_generator.h"
 
 #include <cmath>
-#include <ctime>
-#include <cstdlib>
 #include <cstring>
+#include <algorithm>
 
 namespace hyenae::model::generators
 {
@@ -41,7 +40,8 @@ namespace hyenae::model::generators
     /*---------------------------------------------------------------------- */
 
     integer_generator::integer_generator(
-        const string_t& pattern, size_t base, size_t bits)
+        const string_t& pattern, size_t base, size_t bits) :
+        _ahead_random(0)
     {
         uint64_t max = int_max(bits);
 
@@ -59,10 +59,12 @@ namespace hyenae::model::generators
         max = int_max(bits);
 
         _pattern_len = pattern.size();
+        _ahead_pos = 0;
+        _ahead_step = 0;
         _result_min = result_min(max);
         _result_max = result_max(max);
 
-        srand((unsigned int)time(NULL));
+        compile();
 
         reset(false);
 
@@ -106,28 +108,106 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
-    void integer_generator::next(bool data_changed)
+    string_t integer_generator::get_pattern() const
+    {
+        return _pattern;
+
+    } /* get_pattern */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t integer_generator::get_base() const
+    {
+        return _base;
+
+    } /* get_base */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t integer_generator::get_bits() const
+    {
+        return _bits;
+
+    } /* get_bits */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t integer_generator::get_seed() const
+    {
+        return _random.get_seed();
+
+    } /* get_seed */
+
+    /*---------------------------------------------------------------------- */
+
+    void integer_generator::set_seed(uint64_t seed)
+    {
+        drop_ahead();
+
+        _random.seed(seed);
+
+        reset();
+
+    } /* set_seed */
+
+    /*---------------------------------------------------------------------- */
+
+    void integer_generator::next(bool data_changed, size_t stride)
     {
         // Since the calculation of an offset max value (number of possible
         // steps based on the given pattern) would be the same procedure as
         // for generating the actual result value, we will generate the result
         // value first instead and reset if neccessary.
 
-        _offset++;
+        if (is_constant())
+        {
+            // Fixed patterns have only one value to go through
+
+            return;
+        }
+
+        if (_ahead_pos < _ahead_results.size() && stride == _ahead_step)
+        {
+            // Values rendered ahead (see render_batch()) are taken as they
+            // are, the random engine catches up once all have been taken.
+
+            _offset = _ahead_offsets[_ahead_pos];
+            _result = _ahead_results[_ahead_pos++];
 
-        _result = result();
+            if (_ahead_pos == _ahead_results.size())
+            {
+                _random = _ahead_random;
 
-        if (_result < _result_min)
+                _ahead_results.clear();
+                _ahead_offsets.clear();
+                _ahead_pos = 0;
+            }
+        }
+        else if (!_wraps)
         {
-            _result = _result_max;
+            drop_ahead();
+
+            // Results never leave the range, so going stride values ahead
+            // is a single add to the offset of the +/- wildcard digits.
 
-            _offset = 0;
+            _offset += stride;
+            _result = result(_offset);
         }
-        else if (_result > _result_max)
+        else
         {
-            _result = _result_min;
+            drop_ahead();
+
+            // A result out of range starts over (see step()) at an offset
+            // that depends on where it left the range, so the values in
+            // between have to be stepped through.
+
+            for (size_t i = 0; i < stride; i++)
+            {
+                _offset++;
+                _result = result(_offset);
 
-            _offset = 0;
+                step(_offset, _result);
+            }
         }
 
         if (data_changed)
@@ -141,9 +221,11 @@ namespace hyenae::model::generators
 
     void integer_generator::reset(bool data_changed)
     {
+        drop_ahead();
+
         _offset = 0;
 
-        _result = result();
+        _result = result(_offset);
 
         if (data_changed)
         {
@@ -154,6 +236,129 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
+    bool integer_generator::render_batch(
+        byte_t* buffer, size_t stride, size_t count, size_t step) const
+    {
+        size_t size = data_size();
+        uint64_t value = _result;
+        byte_t* slot = NULL;
+
+        assert::argument_not_null(buffer, "buffer");
+        assert::no_overflow(stride >= size);
+
+        // Transformations that change the size of the value (e.g. to a
+        // checksum of it) need the buffer handling of to_buffer().
+
+        for (size_t i = 0; i < transformation_count(); i++)
+        {
+            if (transformation_at(i)->result_size(size) != size)
+            {
+                return false;
+            }
+        }
+
+        if (count > 1 && !is_constant())
+        {
+            render_ahead(count - 1, step);
+        }
+
+        // Values are stored the same way as by data_to_buffer()
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i > 0 && !is_constant())
+            {
+                value = _ahead_results[_ahead_pos + i - 1];
+            }
+
+            slot = buffer + (i * stride);
+
+            memcpy(slot, &value, size);
+
+            for (size_t j = 0; j < transformation_count(); j++)
+            {
+                transformation_at(j)->transform(slot, size, slot);
+            }
+        }
+
+        return true;
+
+    } /* render_batch */
+
+    /*---------------------------------------------------------------------- */
+
+    bool integer_generator::is_constant() const
+    {
+        return _result_min == _result_max;
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t integer_generator::get_period(size_t max_period) const
+    {
+        size_t cycle = 1;
+        size_t chain = 0;
+        size_t max_chain = 0;
+        uint64_t value = 0;
+
+        if (is_constant())
+        {
+            return 1;
+        }
+
+        if (!_rand_digits.empty())
+        {
+            return PERIOD_UNKNOWN;
+        }
+
+        // Without a wrap-around, the digits of a chain of wildcards
+        // repeat after base^length steps, so the longest chain decides.
+
+        for (const wildcard& wildcard : _wildcards)
+        {
+            chain = wildcard.chained ? chain + 1 : 1;
+            max_chain = std::max(max_chain, chain);
+        }
+
+        for (size_t i = 0; i < max_chain && cycle != PERIOD_UNKNOWN; i++)
+        {
+            if (cycle <= max_period / _base)
+            {
+                cycle *= _base;
+            }
+            else
+            {
+                cycle = PERIOD_UNKNOWN;
+            }
+        }
+
+        // A result out of range wraps around to min or max (see step()),
+        // which only starts the cycle over if that is where it started.
+
+        for (size_t offset = 1; offset <= max_period; offset++)
+        {
+            if (offset == cycle)
+            {
+                return cycle;
+            }
+
+            value = result(offset);
+
+            if (value < _result_min || value > _result_max)
+            {
+                value = value < _result_min ? _result_max : _result_min;
+
+                return value == result(0) ? offset : PERIOD_UNKNOWN;
+            }
+        }
+
+        return PERIOD_UNKNOWN;
+
+    } /* get_period */
+
+    /*---------------------------------------------------------------------- */
+
     uint8_t integer_generator::get_uint8() const
     {
         uint8_t result = 0;
@@ -240,6 +445,19 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
+    data_generator* integer_generator::create_clone(clone_map_t& clones) const
+    {
+        integer_generator* clone =
+            new integer_generator(_pattern, _base, _bits);
+
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
     uint64_t integer_generator::int_max(size_t bits)
     {
         return (uint64_t)pow(2, bits) - 1;
@@ -379,14 +597,19 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
-    uint64_t integer_generator::result() const
+    void integer_generator::compile()
     {
-        uint64_t result = 0;
-        uint64_t result_tmp = 0;
         char cur_chr = 0;
-        uint64_t digit_value = 0;
-        uint64_t cur_offset = 0;
-        uint64_t next_offset = 0;
+        uint64_t weight = 1;
+        size_t rand_count = 0;
+
+        // Fixed digits are summed up into a constant, wildcards are kept
+        // in order of significance, so that generating a result doesn't
+        // have to look at the pattern again.
+
+        _constant = 0;
+        _wildcards.clear();
+        _wraps = false;
 
         for (size_t pos = _pattern_len - 1; pos != SIZE_NONE; pos--)
         {
@@ -396,67 +619,113 @@ namespace hyenae::model::generators
                 cur_chr == INCR_WILDCARD ||
                 cur_chr == DECR_WILDCARD)
             {
+                _wildcards.push_back(
+                {
+                    cur_chr,
+                    weight,
+                    digit_value(_result_max, _base, _pattern_len - pos - 1),
+                    (pos + 1) < _pattern_len && cur_chr == _pattern[pos + 1]
+                });
+
                 if (cur_chr == RAND_WILDCARD)
                 {
-                    digit_value = rand() % (_base);
-
-                    // In order to have a better number randomization on
-                    // smaller bit sizes with high value bases (such as 8-Bit
-                    // decimal), we want to make sure that the generated digit
-                    // will not lead to a result bigger max, since this would
-                    // lead to a truncation to min.
-
-                    result_tmp =
-                        digit_value *
-                        (uint64_t)pow(_base, (double)_pattern_len - pos - 1);
-
-                    if (result_tmp > _result_max)
-                    {
-                        digit_value = 0;
-                    }
+                    rand_count++;
                 }
-                else
+
+                // Only digits capped by the int max can
+                // lead to results out of range.
+
+                if (_wildcards.back().max_digit < _base - 1)
+                {
+                    _wraps = true;
+                }
+            }
+            else
+            {
+                _constant += chr_value(cur_chr, _base) * weight;
+            }
+
+            weight *= _base;
+        }
+
+        _rand_digits.resize(rand_count);
+
+    } /* compile */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t integer_generator::result(uint64_t offset) const
+    {
+        // Draw the digits of all random wildcards at once
+
+        if (!_rand_digits.empty())
+        {
+            _random.fill(_rand_digits.data(), _rand_digits.size(), _base);
+        }
+
+        return result(offset, _rand_digits.data());
+
+    } /* result */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t integer_generator::result(
+        uint64_t offset, const uint64_t* rand_digits) const
+    {
+        uint64_t result = _constant;
+        uint64_t digit_value = 0;
+        uint64_t cur_offset = 0;
+        uint64_t next_offset = 0;
+        size_t rand_index = 0;
+
+        for (const wildcard& wildcard : _wildcards)
+        {
+            if (wildcard.chr == RAND_WILDCARD)
+            {
+                digit_value = rand_digits[rand_index++];
+
+                // In order to have a better number randomization on
+                // smaller bit sizes with high value bases (such as 8-Bit
+                // decimal), we want to make sure that the generated digit
+                // will not lead to a result bigger max, since this would
+                // lead to a truncation to min.
+
+                if (digit_value * wildcard.weight > _result_max)
                 {
-                    if ((pos + 1) < _pattern_len &&
-                        cur_chr == _pattern[pos + 1])
-                    {
-                        // If the previous wildcard was also an
-                        // incrementation or decrementation wildcard,
-                        // use the last base-divided offset instead to
-                        // have the current wildcard's incrementation
-                        // or decrementation steps to be dependend on
-                        // the previous ones.
-
-                        cur_offset = next_offset;
-                    }
-                    else
-                    {
-                        cur_offset = _offset;
-                    }
-
-                    digit_value = cur_offset % _base;
-                    next_offset = cur_offset / _base;
-
-                    if (cur_chr == DECR_WILDCARD)
-                    {
-                        // If this is a decrementation wildcard,
-                        // invert the digit value.
-
-                        digit_value = this->digit_value(
-                            _result_max,
-                            _base,
-                            _pattern_len - pos - 1) - digit_value;
-                    }
+                    digit_value = 0;
                 }
             }
             else
             {
-                digit_value = chr_value(_pattern[pos], _base);
+                if (wildcard.chained)
+                {
+                    // If the previous wildcard was also an
+                    // incrementation or decrementation wildcard,
+                    // use the last base-divided offset instead to
+                    // have the current wildcard's incrementation
+                    // or decrementation steps to be dependend on
+                    // the previous ones.
+
+                    cur_offset = next_offset;
+                }
+                else
+                {
+                    cur_offset = offset;
+                }
+
+                digit_value = cur_offset % _base;
+                next_offset = cur_offset / _base;
+
+                if (wildcard.chr == DECR_WILDCARD)
+                {
+                    // If this is a decrementation wildcard,
+                    // invert the digit value.
+
+                    digit_value = wildcard.max_digit - digit_value;
+                }
             }
 
-            result +=
-                digit_value *
-                (uint64_t)pow(_base, (double)_pattern_len - pos - 1);
+            result += digit_value * wildcard.weight;
         }
 
         return result;
@@ -465,4 +734,124 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
+    void integer_generator::step(uint64_t& offset, uint64_t& result) const
+    {
+        // Results out of range start over at the other end of the range
+
+        if (result < _result_min)
+        {
+            result = _result_max;
+
+            offset = 0;
+        }
+        else if (result > _result_max)
+        {
+            result = _result_min;
+
+            offset = 0;
+        }
+
+    } /* step */
+
+    /*---------------------------------------------------------------------- */
+
+    void integer_generator::render_ahead(size_t count, size_t step) const
+    {
+        size_t rand_count = _rand_digits.size();
+        size_t steps = _wraps ? step : 1;
+        uint64_t offset = 0;
+        uint64_t result = 0;
+        const uint64_t* rand_digits = NULL;
+
+        if (step == _ahead_step &&
+            _ahead_results.size() - _ahead_pos >= count)
+        {
+            return;
+        }
+
+        drop_ahead();
+
+        _ahead_results.resize(count);
+        _ahead_offsets.resize(count);
+        _ahead_step = step;
+
+        // The random digits of all values are drawn with a single fill,
+        // in the same order as next() would draw them. A copy of the
+        // engine does the drawing, so that the engine itself can still
+        // be rewound to the current value (see drop_ahead()).
+
+        _ahead_random = _random;
+
+        if (rand_count > 0)
+        {
+            if (_ahead_digits.size() < count * steps * rand_count)
+            {
+                _ahead_digits.resize(count * steps * rand_count);
+            }
+
+            _ahead_random.fill(
+                _ahead_digits.data(), count * steps * rand_count, _base);
+        }
+
+        rand_digits = _ahead_digits.data();
+        offset = _offset;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!_wraps)
+            {
+                offset += step;
+                result = this->result(offset, rand_digits);
+
+                rand_digits += rand_count;
+            }
+            else
+            {
+                for (size_t j = 0; j < step; j++)
+                {
+                    offset++;
+                    result = this->result(offset, rand_digits);
+
+                    this->step(offset, result);
+
+                    rand_digits += rand_count;
+                }
+            }
+
+            _ahead_offsets[i] = offset;
+            _ahead_results[i] = result;
+        }
+
+    } /* render_ahead */
+
+    /*---------------------------------------------------------------------- */
+
+    void integer_generator::drop_ahead() const
+    {
+        size_t rand_count = _rand_digits.size();
+        size_t steps = _wraps ? _ahead_step : 1;
+
+        if (_ahead_results.empty())
+        {
+            return;
+        }
+
+        // The engine is still where the values ahead were rendered from,
+        // so it is brought to the current value by drawing the digits of
+        // the ones already taken once more.
+
+        if (rand_count > 0 && _ahead_pos > 0)
+        {
+            _random.fill(
+                _ahead_digits.data(), _ahead_pos * steps * rand_count, _base);
+        }
+
+        _ahead_results.clear();
+        _ahead_offsets.clear();
+        _ahead_pos = 0;
+
+    } /* drop_ahead */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators */
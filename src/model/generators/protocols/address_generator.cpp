@@ -59,9 +59,12 @@ namespace hyenae::model::generators::protocols
             field_delimiter,
             field_transformation);
 
+        _pattern = pattern;
         _field_count = _address->generator_count();
         _field_bits = field_bits;
         _base = base;
+        _field_delimiter = field_delimiter;
+        _field_transformation = field_transformation;
 
     } /* address_generator */
 
@@ -120,9 +123,17 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void address_generator::next(bool data_changed)
+    string_t address_generator::get_pattern() const
     {
-        _address->next(false);
+        return _pattern;
+
+    } /* get_pattern */
+
+    /*---------------------------------------------------------------------- */
+
+    void address_generator::next(bool data_changed, size_t stride)
+    {
+        _address->next(false, stride);
 
         if (data_changed)
         {
@@ -146,6 +157,41 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool address_generator::render_batch(
+        byte_t* buffer, size_t stride, size_t count, size_t step) const
+    {
+        size_t offset = 0;
+        const data_generator* field = NULL;
+
+        assert::argument_not_null(buffer, "buffer");
+        assert::no_overflow(stride >= size());
+
+        if (transformation_count() > 0)
+        {
+            return false;
+        }
+
+        // The fields don't depend on each other, so each of them renders
+        // all of its values at once, column by column.
+
+        for (size_t i = 0; i < _address->generator_count(); i++)
+        {
+            field = _address->generator_at(i);
+
+            if (!field->render_batch(buffer + offset, stride, count, step))
+            {
+                return false;
+            }
+
+            offset += field->size();
+        }
+
+        return true;
+
+    } /* render_batch */
+
+    /*---------------------------------------------------------------------- */
+
     void address_generator::to_mac_address(mac_address_t& result) const
     {
         size_t size = sizeof(mac_address_t);
@@ -214,6 +260,40 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool address_generator::is_constant() const
+    {
+        return _address->is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* address_generator::get_layout() const
+    {
+        return _address;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* address_generator::create_clone(clone_map_t& clones) const
+    {
+        address_generator* clone = new address_generator(
+            _pattern,
+            _base,
+            _field_count,
+            _field_bits,
+            _field_delimiter,
+            _field_transformation);
+
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
     generator_group* address_generator::parse_address(
         const string_t& pattern,
         size_t base,
@@ -102,6 +102,8 @@ namespace hyenae::model::generators::protocols
         _target_proto_addr = target_proto_addr;
         _packet.add_generator(_target_proto_addr);
 
+        _packet.add_listener(this);
+
     } /* arp_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -150,12 +152,12 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void arp_frame_generator::next(bool data_changed)
+    void arp_frame_generator::next(bool data_changed, size_t stride)
     {
-        _sender_hw_addr->next(false);
-        _sender_proto_addr->next(false);
-        _target_hw_addr->next(false);
-        _target_proto_addr->next(false);
+        _sender_hw_addr->next(false, stride);
+        _sender_proto_addr->next(false, stride);
+        _target_hw_addr->next(false, stride);
+        _target_proto_addr->next(false, stride);
 
         if (data_changed)
         {
@@ -199,4 +201,40 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool arp_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* arp_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* arp_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        arp_frame_generator* clone = new arp_frame_generator(
+            _hw_addr_type->get_uint16(),
+            _proto_addr_type->get_uint16(),
+            _operation->get_uint16(),
+            (address_generator*)clone_of(_sender_hw_addr, clones),
+            (address_generator*)clone_of(_sender_proto_addr, clones),
+            (address_generator*)clone_of(_target_hw_addr, clones),
+            (address_generator*)clone_of(_target_proto_addr, clones));
+
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators::protocols */
@@ -89,6 +89,8 @@ namespace hyenae::model::generators::protocols
             _fcs->add_generator(&_payload);
         }
 
+        _packet.add_listener(this);
+
     } /* ethernet_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -106,11 +108,11 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void ethernet_frame_generator::next(bool data_changed)
+    void ethernet_frame_generator::next(bool data_changed, size_t stride)
     {
-        _src_mac_addr->next(false);
-        _dst_mac_addr->next(false);
-        _payload.next();
+        _src_mac_addr->next(false, stride);
+        _dst_mac_addr->next(false, stride);
+        _payload.next(false, stride);
 
         if (data_changed)
         {
@@ -125,7 +127,7 @@ namespace hyenae::model::generators::protocols
     {
         _src_mac_addr->reset(false);
         _dst_mac_addr->reset(false);
-        _payload.next();
+        _payload.reset(false);
 
         if (data_changed)
         {
@@ -161,4 +163,41 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool ethernet_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* ethernet_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* ethernet_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        ethernet_frame_generator* clone = new ethernet_frame_generator(
+            _preamble_sfd != NULL,
+            _src_mac_addr->get_pattern(),
+            _dst_mac_addr->get_pattern(),
+            _type->get_uint16(),
+            _fcs != NULL);
+
+        clones[this] = clone;
+
+        _payload.clone_generators(&clone->_payload, clones);
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators::protocols */
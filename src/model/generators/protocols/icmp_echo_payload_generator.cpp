@@ -48,6 +48,8 @@ namespace hyenae::model::generators::protocols
         _seq_num->add_transformation(to_network_order_t::get_instance());
         _packet.add_generator(_seq_num);
 
+        _packet.add_listener(this);
+
     } /* icmp_echo_payload_generator */
 
     /*---------------------------------------------------------------------- */
@@ -61,10 +63,10 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void icmp_echo_payload_generator::next(bool data_changed)
+    void icmp_echo_payload_generator::next(bool data_changed, size_t stride)
     {
-        _id->next(false);
-        _seq_num->next(false);
+        _id->next(false, stride);
+        _seq_num->next(false, stride);
 
         if (data_changed)
         {
@@ -106,4 +108,37 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool icmp_echo_payload_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* icmp_echo_payload_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* icmp_echo_payload_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        icmp_echo_payload_generator* clone = new icmp_echo_payload_generator(
+            _id->get_pattern(),
+            _id->get_base(),
+            _seq_num->get_pattern(),
+            _seq_num->get_base());
+
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators::protocols */
@@ -62,6 +62,8 @@ namespace hyenae::model::generators::protocols
         // Payload
         _packet.add_generator(&_payload);
 
+        _packet.add_listener(this);
+
     } /* icmp_v4_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -76,9 +78,9 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void icmp_v4_frame_generator::next(bool data_changed)
+    void icmp_v4_frame_generator::next(bool data_changed, size_t stride)
     {
-        _payload.next();
+        _payload.next(false, stride);
 
         if (data_changed)
         {
@@ -91,7 +93,7 @@ namespace hyenae::model::generators::protocols
 
     void icmp_v4_frame_generator::reset(bool data_changed)
     {
-        _payload.reset();
+        _payload.reset(false);
         
         if (data_changed)
         {
@@ -127,4 +129,37 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool icmp_v4_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* icmp_v4_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* icmp_v4_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        icmp_v4_frame_generator* clone = new icmp_v4_frame_generator(
+            _type->get_uint8(), _code->get_uint8());
+
+        clones[this] = clone;
+
+        _payload.clone_generators(&clone->_payload, clones);
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators::protocols */
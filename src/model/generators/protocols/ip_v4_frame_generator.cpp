@@ -73,6 +73,7 @@ namespace hyenae::model::generators::protocols
         _flags_frag_offset = fixed_data_generator::allocate_uint16();
         _flags_frag_offset->add_transformation(
             to_network_order_t::get_instance());
+        _flags_frag_offset->set_constant(_frag_offset->is_constant());
         _packet.add_generator(_flags_frag_offset);
         
         // Time to live
@@ -130,6 +131,8 @@ namespace hyenae::model::generators::protocols
         update_flags_frag_offset();
         update_payload_length();
 
+        _packet.add_listener(this);
+
     } /* ip_v4_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -155,13 +158,13 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void ip_v4_frame_generator::next(bool data_changed)
+    void ip_v4_frame_generator::next(bool data_changed, size_t stride)
     {
-        _frag_offset->next(false);
-        _id->next(false);
-        _src_ip_addr->next(false);
-        _dst_ip_addr->next(false);
-        _payload.next();
+        _frag_offset->next(false, stride);
+        _id->next(false, stride);
+        _src_ip_addr->next(false, stride);
+        _dst_ip_addr->next(false, stride);
+        _payload.next(false, stride);
 
         update_payload_length();
         update_flags_frag_offset();
@@ -181,7 +184,7 @@ namespace hyenae::model::generators::protocols
         _id->reset(false);
         _src_ip_addr->reset(false);
         _dst_ip_addr->reset(false);
-        _payload.reset();
+        _payload.reset(false);
 
         update_payload_length();
         update_flags_frag_offset();
@@ -228,6 +231,68 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool ip_v4_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* ip_v4_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* ip_v4_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        ip_v4_frame_generator* clone = new ip_v4_frame_generator(
+            _type_of_service->get_uint8(),
+            _id->get_pattern(),
+            _id->get_base(),
+            _dont_frag,
+            _more_frags,
+            _frag_offset->get_pattern(),
+            _frag_offset->get_base(),
+            _time_to_live->get_uint8(),
+            _protocol->get_uint8(),
+            _src_ip_addr->get_pattern(),
+            _dst_ip_addr->get_pattern());
+
+        // Payloads such as TCP or UDP refer to our pseudo-header, so it has
+        // to be mapped before cloning them.
+
+        clones[this] = clone;
+        clones[&_pseudo_header] = &clone->_pseudo_header;
+
+        _payload.clone_generators(&clone->_payload, clones);
+        clone_transformations(clone);
+
+        clone->update_payload_length();
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
+    void ip_v4_frame_generator::layout_changed()
+    {
+        // Total and pseudo-header length follow the payload as soon as it
+        // is added or replaced, not only with the next packet.
+
+        update_payload_length();
+
+        data_generator::layout_changed();
+
+    } /* layout_changed */
+
+    /*---------------------------------------------------------------------- */
+
     void ip_v4_frame_generator::update_payload_length()
     {
         _total_length->set_uint16(
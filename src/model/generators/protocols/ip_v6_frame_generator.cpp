@@ -50,6 +50,7 @@ namespace hyenae::model::generators::protocols
         _version_traffic_flow = fixed_data_generator::allocate_uint32();
         _version_traffic_flow->add_transformation(
             to_network_order_t::get_instance());
+        _version_traffic_flow->set_constant(_flow_label->is_constant());
         _packet.add_generator(_version_traffic_flow);
         
         // Payload length
@@ -94,6 +95,8 @@ namespace hyenae::model::generators::protocols
         update_version_traffic_flow();
         update_payload_length();
 
+        _packet.add_listener(this);
+
     } /* ip_v6_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -114,12 +117,12 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void ip_v6_frame_generator::next(bool data_changed)
+    void ip_v6_frame_generator::next(bool data_changed, size_t stride)
     {
-        _flow_label->next(false);
-        _src_ip_addr->next(false);
-        _dst_ip_addr->next(false);
-        _payload.next();
+        _flow_label->next(false, stride);
+        _src_ip_addr->next(false, stride);
+        _dst_ip_addr->next(false, stride);
+        _payload.next(false, stride);
 
         update_version_traffic_flow();
         update_payload_length();
@@ -138,7 +141,7 @@ namespace hyenae::model::generators::protocols
         _flow_label->reset(false);
         _src_ip_addr->reset(false);
         _dst_ip_addr->reset(false);
-        _payload.reset();
+        _payload.reset(false);
 
         update_version_traffic_flow();
         update_payload_length();
@@ -185,6 +188,64 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool ip_v6_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* ip_v6_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* ip_v6_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        ip_v6_frame_generator* clone = new ip_v6_frame_generator(
+            _traffic_class,
+            _flow_label->get_pattern(),
+            _flow_label->get_base(),
+            _next_header->get_uint8(),
+            _hop_limit->get_uint8(),
+            _src_ip_addr->get_pattern(),
+            _dst_ip_addr->get_pattern());
+
+        // Payloads such as TCP or UDP refer to our pseudo-header, so it has
+        // to be mapped before cloning them.
+
+        clones[this] = clone;
+        clones[&_pseudo_header] = &clone->_pseudo_header;
+
+        _payload.clone_generators(&clone->_payload, clones);
+        clone_transformations(clone);
+
+        clone->update_payload_length();
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
+    void ip_v6_frame_generator::layout_changed()
+    {
+        // The payload length has to be right before the next packet, e.g.
+        // for a template compiled right after a payload was added.
+
+        update_payload_length();
+
+        data_generator::layout_changed();
+
+    } /* layout_changed */
+
+    /*---------------------------------------------------------------------- */
+
     void ip_v6_frame_generator::update_payload_length()
     {
         _payload_length_16bit->set_uint16((uint16_t)_payload.size());
@@ -56,6 +56,8 @@ namespace hyenae::model::generators::protocols
     {
         assert::argument_not_null(pseudo_header, "pseudo_header");
 
+        _pseudo_header = pseudo_header;
+
         // Source Port
         _src_port = integer_generator::create_uint16(
             src_port_pattern, src_port_pattern_base);
@@ -137,6 +139,8 @@ namespace hyenae::model::generators::protocols
         _checksum->add_generator(_urg_pointer);
         _checksum->add_generator(&_payload);
 
+        _packet.add_listener(this);
+
     } /* tcp_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -158,15 +162,15 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void tcp_frame_generator::next(bool data_changed)
+    void tcp_frame_generator::next(bool data_changed, size_t stride)
     {
-        _src_port->next(false);
-        _dst_port->next(false);
-        _seq_num->next(false);
-        _ack_num->next(false);
-        _win_size->next(false);
-        _urg_pointer->next(false);
-        _payload.next();
+        _src_port->next(false, stride);
+        _dst_port->next(false, stride);
+        _seq_num->next(false, stride);
+        _ack_num->next(false, stride);
+        _win_size->next(false, stride);
+        _urg_pointer->next(false, stride);
+        _payload.next(false, stride);
 
         if (data_changed)
         {
@@ -185,7 +189,7 @@ namespace hyenae::model::generators::protocols
         _ack_num->reset(false);
         _win_size->reset(false);
         _urg_pointer->reset(false);
-        _payload.reset();
+        _payload.reset(false);
 
         if (data_changed)
         {
@@ -221,4 +225,60 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool tcp_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* tcp_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* tcp_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        uint8_t flags = _flags->get_uint8();
+        tcp_frame_generator* clone = NULL;
+
+        clone = new tcp_frame_generator(
+            clone_of(_pseudo_header, clones),
+            _src_port->get_pattern(),
+            _src_port->get_base(),
+            _dst_port->get_pattern(),
+            _dst_port->get_base(),
+            _seq_num->get_pattern(),
+            _seq_num->get_base(),
+            _ack_num->get_pattern(),
+            _ack_num->get_base(),
+            (flags >> 7) & 1,
+            (flags >> 6) & 1,
+            (flags >> 5) & 1,
+            (flags >> 4) & 1,
+            (flags >> 3) & 1,
+            (flags >> 2) & 1,
+            (flags >> 1) & 1,
+            flags & 1,
+            _win_size->get_pattern(),
+            _win_size->get_base(),
+            _urg_pointer->get_pattern(),
+            _urg_pointer->get_base());
+
+        clones[this] = clone;
+
+        _payload.clone_generators(&clone->_payload, clones);
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::generators::protocols */
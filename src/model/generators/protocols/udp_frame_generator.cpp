@@ -40,6 +40,8 @@ namespace hyenae::model::generators::protocols
     {
         assert::argument_not_null(pseudo_header, "pseudo_header");
 
+        _pseudo_header = pseudo_header;
+
         // Source Port
         _src_port = integer_generator::create_uint16(
             src_port_pattern, src_port_pattern_base);
@@ -82,6 +84,8 @@ namespace hyenae::model::generators::protocols
         // Update fields
         update_length();
 
+        _packet.add_listener(this);
+
     } /* udp_frame_generator */
 
     /*---------------------------------------------------------------------- */
@@ -98,11 +102,11 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
-    void udp_frame_generator::next(bool data_changed)
+    void udp_frame_generator::next(bool data_changed, size_t stride)
     {
-        _src_port->next(false);
-        _dst_port->next(false);
-        _payload.next();
+        _src_port->next(false, stride);
+        _dst_port->next(false, stride);
+        _payload.next(false, stride);
 
         update_length();
 
@@ -119,7 +123,7 @@ namespace hyenae::model::generators::protocols
     {
         _src_port->reset(false);
         _dst_port->reset(false);
-        _payload.reset();
+        _payload.reset(false);
 
         update_length();
 
@@ -157,6 +161,58 @@ namespace hyenae::model::generators::protocols
 
     /*---------------------------------------------------------------------- */
 
+    bool udp_frame_generator::is_constant() const
+    {
+        return _packet.is_constant();
+
+    } /* is_constant */
+
+    /*---------------------------------------------------------------------- */
+
+    const generator_group* udp_frame_generator::get_layout() const
+    {
+        return &_packet;
+
+    } /* get_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    data_generator* udp_frame_generator::create_clone(
+        clone_map_t& clones) const
+    {
+        udp_frame_generator* clone = new udp_frame_generator(
+            clone_of(_pseudo_header, clones),
+            _src_port->get_pattern(),
+            _src_port->get_base(),
+            _dst_port->get_pattern(),
+            _dst_port->get_base());
+
+        clones[this] = clone;
+
+        _payload.clone_generators(&clone->_payload, clones);
+        clone_transformations(clone);
+
+        clone->update_length();
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
+    void udp_frame_generator::layout_changed()
+    {
+        // A payload added or replaced changes the length field, which is
+        // rendered as a constant (along with the checksum).
+
+        update_length();
+
+        data_generator::layout_changed();
+
+    } /* layout_changed */
+
+    /*---------------------------------------------------------------------- */
+
     void udp_frame_generator::update_length()
     {
         _length->set_uint16((uint16_t)(8 + _payload.size()));
@@ -73,6 +73,18 @@ namespace hyenae::model::generators
 
     /*---------------------------------------------------------------------- */
 
+    data_generator* string_generator::create_clone(clone_map_t& clones) const
+    {
+        string_generator* clone = new string_generator(_pattern, _encoding);
+
+        clone_transformations(clone);
+
+        return clone;
+
+    } /* create_clone */
+
+    /*---------------------------------------------------------------------- */
+
     size_t string_generator::data_size(encoding encoding) const
     {
         size_t size = 0;
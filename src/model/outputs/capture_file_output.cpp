@@ -0,0 +1,268 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../include/assert.h"
+#include "../../../include/monotonic_clock.h"
+#include "../../../include/model/outputs/capture_file_output.h"
+
+#include <new>
+#include <chrono>
+#include <algorithm>
+
+namespace hyenae::model::outputs
+{
+    /*---------------------------------------------------------------------- */
+
+    capture_file_output::capture_file_output(
+        file_io::provider file_io_provider,
+        const string_t& path,
+        format format,
+        bool nanosecond_resolution,
+        size_t buffer_size)
+    {
+        assert::in_range(buffer_size > 0, "buffer_size");
+
+        _file_io = file_io_provider();
+        _path = path;
+        _format = format;
+        _nanosecond_resolution = nanosecond_resolution;
+        _buffer_size = buffer_size;
+        _buffer = new (std::align_val_t(BUFFER_ALIGNMENT)) byte_t[buffer_size];
+
+    } /* capture_file_output */
+
+    /*---------------------------------------------------------------------- */
+
+    capture_file_output::~capture_file_output()
+    {
+        close();
+
+        safe_delete(_file_io);
+
+        ::operator delete[](_buffer, std::align_val_t(BUFFER_ALIGNMENT));
+
+    } /* ~capture_file_output */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::open()
+    {
+        assert::legal_call(!_file_io->is_open(), "", "already open");
+
+        _file_io->open(_path, true, true);
+
+        _buffer_pos = 0;
+
+        if (_format == format::PCAP)
+        {
+            write_pcap_header();
+        }
+        else
+        {
+            write_pcapng_header();
+        }
+
+    } /* open */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::close() noexcept
+    {
+        if (_file_io != NULL && _file_io->is_open())
+        {
+            write_buffer();
+
+            _file_io->close();
+        }
+
+    } /* close */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::send(byte_t* data, size_t size)
+    {
+        uint64_t timestamp = 0;
+        duration_t now = monotonic_clock::since_epoch();
+
+        assert::legal_call(_file_io->is_open(), "", "not open");
+        assert::argument_not_null(data, "data");
+        assert::in_range(size > 0, "size");
+
+        if (_nanosecond_resolution)
+        {
+            timestamp = (uint64_t)std::chrono::duration_cast<
+                std::chrono::nanoseconds>(now).count();
+        }
+        else
+        {
+            timestamp = (uint64_t)std::chrono::duration_cast<
+                std::chrono::microseconds>(now).count();
+        }
+
+        write_record(data, size, timestamp);
+
+    } /* send */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::write_pcap_header()
+    {
+        uint32_t magic = _nanosecond_resolution ? 0xa1b23c4d : 0xa1b2c3d4;
+        uint16_t version[2] = { 2, 4 };
+        uint32_t fields[4] = { 0, 0, SNAP_LENGTH, LINK_TYPE_ETHERNET };
+
+        // All headers are written in host byte order, readers
+        // detect it by the magic numbers.
+
+        write(&magic, sizeof(magic));
+        write(version, sizeof(version));
+        write(fields, sizeof(fields));
+
+    } /* write_pcap_header */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::write_pcapng_header()
+    {
+        uint32_t section_header[3] = { 0x0a0d0d0a, 28, 0x1a2b3c4d };
+        uint16_t version[2] = { 1, 0 };
+        int64_t section_length = -1;
+        uint32_t interface_length = _nanosecond_resolution ? 32 : 20;
+        uint32_t interface_header[2] = { 1, interface_length };
+        uint16_t link_type[2] = { LINK_TYPE_ETHERNET, 0 };
+        uint32_t snap_length = SNAP_LENGTH;
+        uint16_t resolution_option[2] = { 9, 1 };
+        uint8_t resolution[4] = { 9, 0, 0, 0 };
+        uint32_t end_of_options = 0;
+
+        // Section header block
+
+        write(section_header, sizeof(section_header));
+        write(version, sizeof(version));
+        write(&section_length, sizeof(section_length));
+        write(&section_header[1], sizeof(uint32_t));
+
+        // Interface description block, the if_tsresol
+        // option switches timestamps to nanoseconds.
+
+        write(interface_header, sizeof(interface_header));
+        write(link_type, sizeof(link_type));
+        write(&snap_length, sizeof(snap_length));
+
+        if (_nanosecond_resolution)
+        {
+            write(resolution_option, sizeof(resolution_option));
+            write(resolution, sizeof(resolution));
+            write(&end_of_options, sizeof(end_of_options));
+        }
+
+        write(&interface_length, sizeof(interface_length));
+
+    } /* write_pcapng_header */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::write_record(
+        byte_t* data, size_t size, uint64_t timestamp)
+    {
+        uint32_t units = _nanosecond_resolution ? 1000000000 : 1000000;
+        uint32_t captured = (uint32_t)std::min(size, (size_t)SNAP_LENGTH);
+        uint32_t padded = (captured + 3) & ~3;
+        uint32_t padding = 0;
+
+        if (_format == format::PCAP)
+        {
+            uint32_t header[4] = {
+                (uint32_t)(timestamp / units),
+                (uint32_t)(timestamp % units),
+                captured,
+                (uint32_t)size };
+
+            write(header, sizeof(header));
+            write(data, captured);
+        }
+        else
+        {
+            // Enhanced packet block
+
+            uint32_t header[7] = {
+                6,
+                32 + padded,
+                0,
+                (uint32_t)(timestamp >> 32),
+                (uint32_t)timestamp,
+                captured,
+                (uint32_t)size };
+
+            write(header, sizeof(header));
+            write(data, captured);
+            write(&padding, padded - captured);
+            write(&header[1], sizeof(uint32_t));
+        }
+
+    } /* write_record */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::write(const void* data, size_t size)
+    {
+        // Records are collected in the buffer, so that the file is
+        // written in large chunks instead of once for every field.
+
+        if (_buffer_pos + size > _buffer_size)
+        {
+            write_buffer();
+        }
+
+        if (size > _buffer_size)
+        {
+            _file_io->write((byte_t*)data, size);
+        }
+        else
+        {
+            memcpy(_buffer + _buffer_pos, data, size);
+
+            _buffer_pos += size;
+        }
+
+    } /* write */
+
+    /*---------------------------------------------------------------------- */
+
+    void capture_file_output::write_buffer()
+    {
+        if (_buffer_pos > 0)
+        {
+            _file_io->write(_buffer, _buffer_pos);
+
+            _buffer_pos = 0;
+        }
+
+    } /* write_buffer */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model::outputs */
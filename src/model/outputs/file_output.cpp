@@ -55,7 +55,7 @@ namespace hyenae::model::outputs
     {
         assert::legal_call(!_file_io->is_open(), "", "already open");
 
-        _file_io->open(_path, true);
+        _file_io->open(_path, true, true);
 
     } /* open */
 
@@ -84,4 +84,51 @@ namespace hyenae::model::outputs
 
     /*---------------------------------------------------------------------- */
 
+    void file_output::send_batch(const vector_t<span>& packets)
+    {
+        byte_t* data = NULL;
+        size_t size = 0;
+        bool contiguous = true;
+
+        assert::legal_call(_file_io->is_open(), "", "not open");
+
+        if (packets.empty())
+        {
+            return;
+        }
+
+        data = packets[0].data;
+
+        for (auto& packet : packets)
+        {
+            contiguous = contiguous && packet.data == data + size;
+            size += packet.size;
+        }
+
+        // Packets that don't follow each other in memory are
+        // gathered first, so the file is written only once.
+
+        if (!contiguous)
+        {
+            if (_batch_buffer.size() < size)
+            {
+                _batch_buffer.resize(size);
+            }
+
+            data = _batch_buffer.data();
+            size = 0;
+
+            for (auto& packet : packets)
+            {
+                memcpy(data + size, packet.data, packet.size);
+                size += packet.size;
+            }
+        }
+
+        _file_io->write(data, size);
+
+    } /* send_batch */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::outputs */
@@ -32,6 +32,10 @@
     #include <unistd.h>
 #endif
 
+#ifdef OS_LINUX
+    #include <cerrno>
+#endif
+
 namespace hyenae::model::outputs
 {
     /*---------------------------------------------------------------------- */
@@ -94,6 +98,8 @@ namespace hyenae::model::outputs
         char error[PCAP_ERRBUF_SIZE];
 
         assert::legal_call(_pcap == NULL, "", "already open");
+
+        _failure_count = 0;
         
         _pcap = pcap_open_live(
             _device->get_name().c_str(), BUFSIZ, 0, 0, error);
@@ -131,10 +137,136 @@ namespace hyenae::model::outputs
 
         result = pcap_sendpacket(_pcap, (unsigned char*)data, size);
 
-        assert::legal_state(result == 0, "", "Failed to write to network");
+        if (result != 0)
+        {
+            // Transient queue-full errors are counted instead
+            // of thrown, see is_transient_failure().
+
+            if (!is_transient_failure())
+            {
+                assert::legal_state(false, "", "Failed to write to network");
+            }
+
+            _failure_count++;
+        }
         
     } /* send */
 
     /*---------------------------------------------------------------------- */
 
+    void network_output::send_batch(const vector_t<span>& packets)
+    {
+        assert::legal_call(_pcap != NULL, "", "not open");
+
+        #ifdef OS_LINUX
+            int socket = pcap_get_selectable_fd(_pcap);
+            size_t sent = 0;
+            int result = 0;
+
+            // Libpcap sends with plain send() calls on this socket
+            // itself, so the whole batch can be passed with one call.
+
+            if (socket != -1)
+            {
+                if (_messages.size() < packets.size())
+                {
+                    _messages.resize(packets.size());
+                    _vectors.resize(packets.size());
+                }
+
+                for (size_t i = 0; i < packets.size(); i++)
+                {
+                    _vectors[i].iov_base = packets[i].data;
+                    _vectors[i].iov_len = packets[i].size;
+
+                    memset(&_messages[i], 0, sizeof(mmsghdr));
+                    _messages[i].msg_hdr.msg_iov = &_vectors[i];
+                    _messages[i].msg_hdr.msg_iovlen = 1;
+                }
+
+                while (sent < packets.size())
+                {
+                    result = sendmmsg(
+                        socket,
+                        &_messages[sent],
+                        (unsigned int)(packets.size() - sent),
+                        0);
+
+                    if (result == -1 && errno != EINTR)
+                    {
+                        if (!is_transient_failure())
+                        {
+                            assert::legal_state(
+                                false, "", "Failed to write to network");
+                        }
+
+                        // The packet the kernel refused is dropped,
+                        // so that the batch doesn't stall on it.
+
+                        _failure_count++;
+                        sent++;
+                    }
+
+                    if (result > 0)
+                    {
+                        sent += result;
+                    }
+                }
+
+                return;
+            }
+        #endif
+
+        for (auto& packet : packets)
+        {
+            if (pcap_inject(_pcap, packet.data, packet.size) == -1)
+            {
+                if (!is_transient_failure())
+                {
+                    assert::legal_state(
+                        false, "", "Failed to write to network");
+                }
+
+                _failure_count++;
+            }
+        }
+
+    } /* send_batch */
+
+    /*---------------------------------------------------------------------- */
+
+    data_output* network_output::clone() const
+    {
+        // Every clone opens its own handle on the same device
+
+        return new network_output(_device);
+
+    } /* clone */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t network_output::get_failure_count() const
+    {
+        return _failure_count;
+
+    } /* get_failure_count */
+
+    /*---------------------------------------------------------------------- */
+
+    bool network_output::is_transient_failure()
+    {
+        // A full transmit queue only drops the packet at hand, which is
+        // counted instead of ending the run (e.g. when flooding a link
+        // faster than it can send). Anything else is fatal.
+
+        #ifdef OS_LINUX
+            return errno == ENOBUFS || errno == EAGAIN;
+        #else
+            return false;
+        #endif
+
+    } /* is_transient_failure */
+
+    /*---------------------------------------------------------------------- */
+
 } /* hyenae::model::outputs */
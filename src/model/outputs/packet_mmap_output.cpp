@@ -0,0 +1,472 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../include/os.h"
+#include "../../../include/assert.h"
+#include "../../../include/model/outputs/packet_mmap_output.h"
+
+#include <cstring>
+#include <algorithm>
+
+#ifdef OS_LINUX
+    #include <cerrno>
+    #include <unistd.h>
+    #include <net/if.h>
+    #include <arpa/inet.h>
+    #include <sys/mman.h>
+    #include <sys/ioctl.h>
+    #include <sys/socket.h>
+    #include <linux/if_ether.h>
+    #include <linux/if_packet.h>
+#endif
+
+namespace hyenae::model::outputs
+{
+    /*---------------------------------------------------------------------- */
+
+    packet_mmap_output::packet_mmap_output(
+        network_output::device* device,
+        size_t frame_size,
+        size_t frame_count,
+        size_t batch_size)
+    {
+        assert::argument_not_null((void*)device, "device");
+        assert::in_range(frame_count > 0, "frame_count");
+        assert::in_range(batch_size > 0, "batch_size");
+
+        _device = device;
+        _frame_size = frame_size;
+        _frame_count = frame_count;
+        _batch_size = batch_size;
+
+    } /* packet_mmap_output */
+
+    /*---------------------------------------------------------------------- */
+
+    packet_mmap_output::~packet_mmap_output()
+    {
+        close();
+
+    } /* ~packet_mmap_output */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_mmap_output::is_supported()
+    {
+        #ifdef OS_LINUX
+            return true;
+        #else
+            return false;
+        #endif
+
+    } /* is_supported */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::send(byte_t* data, size_t size)
+    {
+        assert::argument_not_null(data, "data");
+        assert::in_range(size > 0, "size");
+
+        memcpy(reserve(size), data, size);
+        commit(size);
+
+    } /* send */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::send_batch(const vector_t<span>& packets)
+    {
+        for (auto& packet : packets)
+        {
+            send(packet.data, packet.size);
+        }
+
+        flush();
+
+    } /* send_batch */
+
+    /*---------------------------------------------------------------------- */
+
+    data_output* packet_mmap_output::clone() const
+    {
+        // Every clone maps a ring of it's own
+
+        return new packet_mmap_output(
+            _device, _frame_size, _frame_count, _batch_size);
+
+    } /* clone */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_mmap_output::get_failure_count() const
+    {
+        return _failure_count;
+
+    } /* get_failure_count */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_mmap_output::frame_at(size_t pos) const
+    {
+        // Frames never span blocks, so a block
+        // may end with some unused space.
+
+        return
+            _ring +
+            ((pos / _frames_per_block) * _block_size) +
+            ((pos % _frames_per_block) * _ring_frame_size);
+
+    } /* frame_at */
+
+    /*---------------------------------------------------------------------- */
+
+#ifdef OS_LINUX
+
+    /*---------------------------------------------------------------------- */
+
+    const size_t DATA_OFFSET = TPACKET_ALIGN(sizeof(tpacket2_hdr));
+    const size_t VLAN_TAG_SIZE = 4;
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::open()
+    {
+        sockaddr_ll address;
+
+        assert::legal_call(_socket == -1, "", "already open");
+        assert::legal_state(
+            geteuid() == 0, "", "network access denied, no root user");
+
+        // Protocol 0 keeps the kernel from queueing
+        // received packets on this send-only socket.
+
+        _socket = socket(AF_PACKET, SOCK_RAW, 0);
+
+        assert::legal_state(
+            _socket != -1, "", "Failed to open packet socket");
+
+        try
+        {
+            setup_ring();
+
+            memset(&address, 0, sizeof(address));
+            address.sll_family = AF_PACKET;
+            address.sll_protocol = htons(ETH_P_ALL);
+            address.sll_ifindex =
+                if_nametoindex(_device->get_name().c_str());
+
+            assert::legal_state(
+                address.sll_ifindex != 0, "", "Unknown network device");
+
+            assert::legal_state(
+                bind(_socket, (sockaddr*)&address, sizeof(address)) == 0,
+                "",
+                "Failed to bind packet socket");
+        }
+        catch (const exception_t&)
+        {
+            close();
+
+            throw;
+        }
+
+    } /* open */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::close() noexcept
+    {
+        if (_socket != -1)
+        {
+            if (_ring != NULL)
+            {
+                // Wait for all queued frames to be sent
+
+                ::send(_socket, NULL, 0, 0);
+
+                munmap(_ring, _block_size * _block_count);
+
+                _ring = NULL;
+            }
+
+            ::close(_socket);
+
+            _socket = -1;
+            _frame_pos = 0;
+            _pending = 0;
+            _failure_count = 0;
+        }
+
+    } /* close */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_mmap_output::reserve(size_t size)
+    {
+        bool retry = true;
+
+        assert::legal_call(_ring != NULL, "", "not open");
+        assert::no_overflow(size <= _ring_frame_size - DATA_OFFSET, "size");
+
+        // Ring is full, wait for the kernel to send the pending frames
+        // before reusing the slot. A dropped frame ends the kernel's
+        // pass early and leaves the frames behind it queued, so it
+        // is kicked again until the slot is free.
+
+        while (retry && !is_available(_frame_pos))
+        {
+            retry = kick(true);
+        }
+
+        if (!is_available(_frame_pos))
+        {
+            assert::legal_state(false, "", "Failed to write to network");
+        }
+
+        return frame_at(_frame_pos) + DATA_OFFSET;
+
+    } /* reserve */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::commit(size_t size)
+    {
+        tpacket2_hdr* header = (tpacket2_hdr*)frame_at(_frame_pos);
+
+        assert::legal_call(_ring != NULL, "", "not open");
+
+        header->tp_len = (uint32_t)size;
+
+        __atomic_store_n(
+            &header->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+        _frame_pos = (_frame_pos + 1) % _ring_frame_count;
+
+        if (++_pending >= _batch_size)
+        {
+            kick(false);
+        }
+
+    } /* commit */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::flush()
+    {
+        if (_pending > 0)
+        {
+            kick(false);
+        }
+
+    } /* flush */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::setup_ring()
+    {
+        tpacket_req request;
+        ifreq interface;
+        int version = TPACKET_V2;
+        int bypass = 1;
+        size_t page_size = (size_t)getpagesize();
+
+        _ring_frame_size = _frame_size;
+        _ring_frame_count = _frame_count;
+
+        if (_frame_size == FRAME_SIZE_AUTO)
+        {
+            // Frames have to hold the largest packet the device can send
+            // (e.g. jumbo frames). Fewer of them are used if they are
+            // larger than the default, so that the ring doesn't take
+            // more memory than with the default frames.
+
+            memset(&interface, 0, sizeof(interface));
+            strncpy(
+                interface.ifr_name,
+                _device->get_name().c_str(),
+                sizeof(interface.ifr_name) - 1);
+
+            assert::legal_state(
+                ioctl(_socket, SIOCGIFMTU, &interface) == 0,
+                "",
+                "Failed to get device MTU");
+
+            _ring_frame_size = std::max(
+                (size_t)DEFAULT_FRAME_SIZE,
+                DATA_OFFSET +
+                    ETH_HLEN +
+                    VLAN_TAG_SIZE +
+                    (size_t)interface.ifr_mtu);
+
+            _ring_frame_count = std::max(
+                _batch_size,
+                _frame_count * DEFAULT_FRAME_SIZE / _ring_frame_size);
+        }
+
+        assert::in_range(_ring_frame_size > DATA_OFFSET, "frame_size");
+
+        _ring_frame_size = TPACKET_ALIGN(_ring_frame_size);
+
+        _block_size =
+            ((_ring_frame_size + page_size - 1) / page_size) * page_size;
+
+        _frames_per_block = _block_size / _ring_frame_size;
+        _block_count =
+            (_ring_frame_count + _frames_per_block - 1) / _frames_per_block;
+        _ring_frame_count = _block_count * _frames_per_block;
+
+        assert::legal_state(
+            setsockopt(
+                _socket,
+                SOL_PACKET,
+                PACKET_VERSION,
+                &version,
+                sizeof(version)) == 0,
+            "",
+            "Failed to set packet socket version");
+
+        // Skipping the queueing discipline is optional,
+        // it's only available on newer kernels.
+
+        setsockopt(
+            _socket, SOL_PACKET, PACKET_QDISC_BYPASS, &bypass, sizeof(bypass));
+
+        memset(&request, 0, sizeof(request));
+        request.tp_block_size = (unsigned int)_block_size;
+        request.tp_block_nr = (unsigned int)_block_count;
+        request.tp_frame_size = (unsigned int)_ring_frame_size;
+        request.tp_frame_nr = (unsigned int)_ring_frame_count;
+
+        assert::legal_state(
+            setsockopt(
+                _socket,
+                SOL_PACKET,
+                PACKET_TX_RING,
+                &request,
+                sizeof(request)) == 0,
+            "",
+            "Failed to set up transmit ring");
+
+        _ring = (byte_t*)mmap(
+            NULL,
+            _block_size * _block_count,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED,
+            _socket,
+            0);
+
+        if (_ring == MAP_FAILED)
+        {
+            _ring = NULL;
+
+            assert::legal_state(false, "", "Failed to map transmit ring");
+        }
+
+    } /* setup_ring */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_mmap_output::is_available(size_t pos) const
+    {
+        tpacket2_hdr* header = (tpacket2_hdr*)frame_at(pos);
+
+        return
+            __atomic_load_n(&header->tp_status, __ATOMIC_ACQUIRE) ==
+                TP_STATUS_AVAILABLE;
+
+    } /* is_available */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_mmap_output::kick(bool wait)
+    {
+        ssize_t result = 0;
+
+        // A single call hands all queued frames to the kernel
+
+        result = ::send(_socket, NULL, 0, wait ? 0 : MSG_DONTWAIT);
+
+        _pending = 0;
+
+        if (result == -1)
+        {
+            if (errno == ENOBUFS)
+            {
+                // With the queueing discipline bypassed, a full driver
+                // queue drops the frame at hand. It's counted instead
+                // of ending the run, like network_output does.
+
+                _failure_count++;
+
+                return true;
+            }
+
+            if (errno == EINTR)
+            {
+                return true;
+            }
+
+            if (errno != EAGAIN)
+            {
+                assert::legal_state(false, "", "Failed to write to network");
+            }
+        }
+
+        return false;
+
+    } /* kick */
+
+    /*---------------------------------------------------------------------- */
+
+#else
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::open()
+    {
+        assert::legal_state(
+            false, "", "Transmit rings are only supported on Linux");
+
+    } /* open */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_mmap_output::close() noexcept {}
+    byte_t* packet_mmap_output::reserve(size_t size) { return NULL; }
+    void packet_mmap_output::commit(size_t size) {}
+    void packet_mmap_output::flush() {}
+    void packet_mmap_output::setup_ring() {}
+    bool packet_mmap_output::is_available(size_t pos) const { return false; }
+    bool packet_mmap_output::kick(bool wait) { return false; }
+
+    /*---------------------------------------------------------------------- */
+
+#endif /* OS_LINUX */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model::outputs */
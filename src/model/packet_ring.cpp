@@ -0,0 +1,144 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/model/packet_ring.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    packet_ring::packet_ring(size_t depth, size_t slot_size)
+    {
+        assert::in_range(depth > 0, "depth");
+        assert::in_range(slot_size > 0, "slot_size");
+
+        // A power of two depth lets the free running
+        // indices wrap around without a modulo.
+
+        _depth = 1;
+
+        while (_depth < depth)
+        {
+            _depth <<= 1;
+        }
+
+        _slot_size = slot_size;
+        _buffer.resize(_depth * _slot_size);
+
+    } /* packet_ring */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_ring::get_depth() const
+    {
+        return _depth;
+
+    } /* get_depth */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_ring::get_slot_size() const
+    {
+        return _slot_size;
+
+    } /* get_slot_size */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_ring::reserve()
+    {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+
+        if (tail - _head.load(std::memory_order_acquire) == _depth)
+        {
+            return NULL;
+        }
+
+        return slot_at(tail);
+
+    } /* reserve */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_ring::commit()
+    {
+        _tail.fetch_add(1, std::memory_order_release);
+
+    } /* commit */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_ring::peek() const
+    {
+        size_t head = _head.load(std::memory_order_relaxed);
+
+        if (head == _tail.load(std::memory_order_acquire))
+        {
+            return NULL;
+        }
+
+        return slot_at(head);
+
+    } /* peek */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_ring::release()
+    {
+        _head.fetch_add(1, std::memory_order_release);
+
+    } /* release */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_ring::close()
+    {
+        _closed = true;
+
+    } /* close */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_ring::is_closed() const
+    {
+        return _closed;
+
+    } /* is_closed */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_ring::slot_at(size_t index) const
+    {
+        return
+            (byte_t*) _buffer.data() +
+            ((index & (_depth - 1)) * _slot_size);
+
+    } /* slot_at */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
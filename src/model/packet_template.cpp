@@ -0,0 +1,303 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/model/generator_group.h"
+#include "../../include/model/packet_template.h"
+
+#include <cstring>
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    packet_template::packet_template(data_generator* generator, size_t step)
+    {
+        assert::argument_not_null(generator, "generator");
+        assert::in_range(step > 0, "step");
+
+        _generator = generator;
+        _step = step;
+
+        compile();
+
+    } /* packet_template */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::compile()
+    {
+        _data.resize(_generator->size());
+        _patches.clear();
+        _row = BATCH_COUNT;
+
+        // Constant fields are rendered only once, right here
+
+        _generator->to_buffer(_data.data(), _data.size());
+
+        compile(_generator, 0, [this](auto generator, auto offset)
+        {
+            compile_patch(generator, offset);
+        });
+
+    } /* compile */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::size() const
+    {
+        return _data.size();
+
+    } /* size */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::patch_count() const
+    {
+        return _patches.size();
+
+    } /* patch_count */
+
+    /*---------------------------------------------------------------------- */
+
+    const packet_template::patch* packet_template::patch_at(
+        size_t pos) const
+    {
+        assert::in_range(pos < _patches.size(), "pos");
+
+        return &_patches[pos];
+
+    } /* patch_at */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_template::render()
+    {
+        if (_row == BATCH_COUNT)
+        {
+            render_batch();
+        }
+
+        for (auto& patch : _patches)
+        {
+            if (patch.is_incremental())
+            {
+                update(patch);
+            }
+            else if (patch.is_batched())
+            {
+                memcpy(
+                    _data.data() + patch.get_offset(),
+                    patch.get_column() + (_row * patch.get_size()),
+                    patch.get_size());
+            }
+            else
+            {
+                patch.get_source()->to_buffer(
+                    _data.data() + patch.get_offset(), patch.get_size());
+            }
+        }
+
+        return _data.data();
+
+    } /* render */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::next()
+    {
+        // The generator has to be advanced through the template, so that
+        // the row of the batched fields keeps up with it.
+
+        _generator->next(true, _step);
+
+        if (_row < BATCH_COUNT)
+        {
+            _row++;
+        }
+
+    } /* next */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::compile(
+        const data_generator* generator, size_t offset, action_t action)
+    {
+        const generator_group* layout = NULL;
+
+        if (generator->is_constant())
+        {
+            return;
+        }
+
+        // Only generators that don't transform their data are just the
+        // sum of their layout's parts. All others (e.g. checksums) have
+        // to be rendered as a whole.
+
+        if (generator->transformation_count() == 0)
+        {
+            layout = generator->get_layout();
+        }
+
+        if (layout != NULL)
+        {
+            compile_layout(layout, offset, action);
+        }
+        else
+        {
+            action(generator, offset);
+        }
+
+    } /* compile */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::compile_layout(
+        const generator_group* layout, size_t offset, action_t action)
+    {
+        const data_generator* generator = NULL;
+
+        for (size_t pos = 0; pos < layout->generator_count(); pos++)
+        {
+            generator = layout->generator_at(pos);
+
+            compile(generator, offset, action);
+
+            offset += generator->size();
+        }
+
+    } /* compile_layout */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_template::is_incremental(const data_generator* generator)
+    {
+        return
+            generator->transformation_count() == 1 &&
+            generator->transformation_at(0)->is_incremental() &&
+            generator->get_layout() != NULL;
+
+    } /* is_incremental */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::compile_patch(
+        const data_generator* generator, size_t offset)
+    {
+        patch patch(offset, generator->size(), generator);
+
+        // Incremental checksums only have to be updated by the fields of
+        // their layout that did actually change since the last packet.
+
+        if (is_incremental(generator))
+        {
+            compile_layout(
+                generator->get_layout(),
+                0,
+                [this, &patch](auto generator, auto offset)
+                {
+                    patch.add_field(field(offset, generator));
+
+                    if (_field_buffer.size() < generator->size())
+                    {
+                        _field_buffer.resize(generator->size());
+                    }
+                });
+        }
+        else
+        {
+            // All others are rendered a batch ahead, if their
+            // generator supports it (see render_batch()).
+
+            patch.set_batched(true);
+        }
+
+        _patches.push_back(patch);
+
+    } /* compile_patch */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::update(patch& patch)
+    {
+        field* field = NULL;
+        byte_t* result = _data.data() + patch.get_offset();
+        byte_t* new_data = _field_buffer.data();
+
+        const data_transformation* transformation =
+            patch.get_source()->transformation_at(0);
+
+        for (size_t pos = 0; pos < patch.field_count(); pos++)
+        {
+            field = patch.field_at(pos);
+
+            field->get_source()->to_buffer(new_data, field->get_size());
+
+            if (memcmp(new_data, field->get_data(), field->get_size()) != 0)
+            {
+                transformation->update(
+                    result,
+                    field->get_data(),
+                    new_data,
+                    field->get_size(),
+                    field->get_offset());
+
+                memcpy(field->get_data(), new_data, field->get_size());
+            }
+        }
+
+    } /* update */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::render_batch()
+    {
+        // Fields that only depend on themselves (e.g. addresses or ports)
+        // render the values of the next BATCH_COUNT packets in one go, as
+        // a column that is then copied from row by row. Fields derived
+        // from others (e.g. lengths or checksums) can't tell their values
+        // ahead of the generator and are still rendered for each packet.
+
+        for (auto& patch : _patches)
+        {
+            if (patch.is_batched() &&
+                !patch.get_source()->render_batch(
+                    patch.get_column(),
+                    patch.get_size(),
+                    BATCH_COUNT,
+                    _step))
+            {
+                patch.set_batched(false);
+            }
+        }
+
+        _row = 0;
+
+    } /* render_batch */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
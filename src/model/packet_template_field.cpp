@@ -0,0 +1,81 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/model/packet_template.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    packet_template::field::field(
+        size_t offset, const data_generator* source)
+    {
+        assert::argument_not_null(source, "source");
+
+        _offset = offset;
+        _source = source;
+
+        _data.resize(source->size());
+        source->to_buffer(_data.data(), _data.size());
+
+    } /* field */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::field::get_offset() const
+    {
+        return _offset;
+
+    } /* get_offset */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::field::get_size() const
+    {
+        return _data.size();
+
+    } /* get_size */
+
+    /*---------------------------------------------------------------------- */
+
+    const data_generator* packet_template::field::get_source() const
+    {
+        return _source;
+
+    } /* get_source */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_template::field::get_data()
+    {
+        return _data.data();
+
+    } /* get_data */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
@@ -0,0 +1,134 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/model/packet_template.h"
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    packet_template::patch::patch(
+        size_t offset,
+        size_t size,
+        const data_generator* source)
+    {
+        _offset = offset;
+        _size = size;
+        _source = source;
+
+    } /* patch */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::patch::get_offset() const
+    {
+        return _offset;
+
+    } /* get_offset */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::patch::get_size() const
+    {
+        return _size;
+
+    } /* get_size */
+
+    /*---------------------------------------------------------------------- */
+
+    const data_generator* packet_template::patch::get_source() const
+    {
+        return _source;
+
+    } /* get_source */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_template::patch::is_incremental() const
+    {
+        return _fields.size() > 0;
+
+    } /* is_incremental */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t packet_template::patch::field_count() const
+    {
+        return _fields.size();
+
+    } /* field_count */
+
+    /*---------------------------------------------------------------------- */
+
+    packet_template::field* packet_template::patch::field_at(size_t pos)
+    {
+        return &_fields.at(pos);
+
+    } /* field_at */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::patch::add_field(const field& field)
+    {
+        _fields.push_back(field);
+
+    } /* add_field */
+
+    /*---------------------------------------------------------------------- */
+
+    bool packet_template::patch::is_batched() const
+    {
+        return _column.size() > 0;
+
+    } /* is_batched */
+
+    /*---------------------------------------------------------------------- */
+
+    void packet_template::patch::set_batched(bool batched)
+    {
+        if (batched)
+        {
+            _column.resize(_size * BATCH_COUNT);
+        }
+        else
+        {
+            _column.clear();
+            _column.shrink_to_fit();
+        }
+
+    } /* set_batched */
+
+    /*---------------------------------------------------------------------- */
+
+    byte_t* packet_template::patch::get_column()
+    {
+        return _column.data();
+
+    } /* get_column */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
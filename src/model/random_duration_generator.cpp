@@ -27,9 +27,6 @@
 #include "../../include/assert.h"
 #include "../../include/model/random_duration_generator.h"
 
-#include <ctime>
-#include <cstdlib>
-
 namespace hyenae::model
 {
     /*---------------------------------------------------------------------- */
@@ -43,8 +40,6 @@ namespace hyenae::model
         _min_duration = min_duration;
         _max_duration = max_duration;
 
-        srand((unsigned int)time(NULL));
-
     } /* random_duration_generator */
 
     /*---------------------------------------------------------------------- */
@@ -65,13 +60,30 @@ namespace hyenae::model
 
     /*---------------------------------------------------------------------- */
 
+    uint64_t random_duration_generator::get_seed() const
+    {
+        return _random.get_seed();
+
+    } /* get_seed */
+
+    /*---------------------------------------------------------------------- */
+
+    void random_duration_generator::set_seed(uint64_t seed)
+    {
+        _random.seed(seed);
+
+    } /* set_seed */
+
+    /*---------------------------------------------------------------------- */
+
     duration_t random_duration_generator::next()
     {
+        uint64_t range =
+            (uint64_t)(_max_duration.count() - _min_duration.count()) + 1;
+
         return duration_t
         {
-            rand() %
-            (_max_duration.count() - _min_duration.count() + 1) +
-            _min_duration.count()
+            (duration_t::rep)_random.next(range) + _min_duration.count()
         };
 
     } /* next */
@@ -0,0 +1,196 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/model/random_engine.h"
+
+#include <random>
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    // Engines created without an explicit seed draw theirs from this
+    // sequence, so a fixed default seed makes the whole run reproducible.
+
+    atomic_t<uint64_t> random_engine::_seed_sequence =
+        ((uint64_t)std::random_device{}() << 32) ^
+        (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+
+    /*---------------------------------------------------------------------- */
+
+    random_engine::random_engine()
+    {
+        uint64_t sequence = _seed_sequence.fetch_add(1);
+
+        seed(split_mix(sequence));
+
+    } /* random_engine */
+
+    /*---------------------------------------------------------------------- */
+
+    random_engine::random_engine(uint64_t seed)
+    {
+        this->seed(seed);
+
+    } /* random_engine */
+
+    /*---------------------------------------------------------------------- */
+
+    void random_engine::set_default_seed(uint64_t seed)
+    {
+        _seed_sequence = seed;
+
+    } /* set_default_seed */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::get_seed() const
+    {
+        return _seed;
+
+    } /* get_seed */
+
+    /*---------------------------------------------------------------------- */
+
+    void random_engine::seed(uint64_t seed)
+    {
+        uint64_t state = seed;
+
+        _seed = seed;
+
+        // xoshiro256** must not start with an all-zero state,
+        // which SplitMix64 never produces for all four words.
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            _state[i] = split_mix(state);
+        }
+
+    } /* seed */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::next()
+    {
+        uint64_t result = rotate_left(_state[1] * 5, 7) * 9;
+        uint64_t t = _state[1] << 17;
+
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+
+        _state[2] ^= t;
+
+        _state[3] = rotate_left(_state[3], 45);
+
+        return result;
+
+    } /* next */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::next(uint64_t bound)
+    {
+        assert::in_range(bound > 0, "bound");
+
+        return next(bound, threshold(bound));
+
+    } /* next */
+
+    /*---------------------------------------------------------------------- */
+
+    void random_engine::fill(uint64_t* values, size_t count, uint64_t bound)
+    {
+        uint64_t threshold = 0;
+
+        assert::argument_not_null(values, "values");
+        assert::in_range(bound > 0, "bound");
+
+        // The threshold costs a division, so it
+        // is only calculated once for all values.
+
+        threshold = this->threshold(bound);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            values[i] = next(bound, threshold);
+        }
+
+    } /* fill */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::next(uint64_t bound, uint64_t threshold)
+    {
+        uint64_t value = 0;
+
+        do
+        {
+            value = next();
+        }
+        while (value < threshold);
+
+        return value % bound;
+
+    } /* next */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::threshold(uint64_t bound)
+    {
+        // Values below the threshold would make the lower
+        // results more likely than the upper ones.
+
+        return (0 - bound) % bound;
+
+    } /* threshold */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::split_mix(uint64_t& state)
+    {
+        uint64_t result = (state += 0x9e3779b97f4a7c15);
+
+        result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9;
+        result = (result ^ (result >> 27)) * 0x94d049bb133111eb;
+
+        return result ^ (result >> 31);
+
+    } /* split_mix */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t random_engine::rotate_left(uint64_t value, int count)
+    {
+        return (value << count) | (value >> (64 - count));
+
+    } /* rotate_left */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
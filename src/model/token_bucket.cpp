@@ -0,0 +1,156 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../include/assert.h"
+#include "../../include/model/token_bucket.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace hyenae::model
+{
+    /*---------------------------------------------------------------------- */
+
+    // All accounting is done in picoseconds, so that the cost of a
+    // single packet at multi-gigabit rates doesn't get rounded off.
+
+    const double PICOSECONDS_PER_SECOND = 1e12;
+
+    /*---------------------------------------------------------------------- */
+
+    token_bucket::token_bucket(
+        uint64_t packet_rate,
+        uint64_t bit_rate,
+        size_t burst_size)
+    {
+        assert::in_range(
+            packet_rate != RATE_UNLIMITED || bit_rate != RATE_UNLIMITED,
+            "",
+            "No packet or bit rate set");
+
+        assert::in_range(burst_size > 0, "burst_size");
+
+        _packet_rate = packet_rate;
+        _bit_rate = bit_rate;
+        _burst_size = burst_size;
+
+        _packet_cost =
+            packet_rate != RATE_UNLIMITED ?
+                PICOSECONDS_PER_SECOND / packet_rate : 0;
+
+        _bit_cost =
+            bit_rate != RATE_UNLIMITED ?
+                PICOSECONDS_PER_SECOND / bit_rate : 0;
+
+        reset();
+
+    } /* token_bucket */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t token_bucket::get_packet_rate() const
+    {
+        return _packet_rate;
+
+    } /* get_packet_rate */
+
+    /*---------------------------------------------------------------------- */
+
+    uint64_t token_bucket::get_bit_rate() const
+    {
+        return _bit_rate;
+
+    } /* get_bit_rate */
+
+    /*---------------------------------------------------------------------- */
+
+    size_t token_bucket::get_burst_size() const
+    {
+        return _burst_size;
+
+    } /* get_burst_size */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t token_bucket::consume(size_t size)
+    {
+        int64_t cost = 0;
+        int64_t tolerance = 0;
+        int64_t current = now();
+        int64_t next_at = _next_at.load(std::memory_order_relaxed);
+        int64_t updated_at = 0;
+
+        cost = (int64_t)std::llround(
+            std::max(_packet_cost, _bit_cost * size * 8));
+
+        tolerance = cost * (int64_t)(_burst_size - 1);
+
+        // Takes the tokens for a packet that has just been sent. The
+        // bucket is represented by the time at which it will be empty,
+        // so that concurrent workers can share it without locking.
+
+        do
+        {
+            updated_at = std::max(next_at, current) + cost;
+        }
+        while (!_next_at.compare_exchange_weak(
+            next_at, updated_at, std::memory_order_relaxed));
+
+        // The next packet may be sent as soon as
+        // the bucket holds enough tokens for it.
+
+        if (updated_at - tolerance > current)
+        {
+            return std::chrono::duration_cast<duration_t>(
+                std::chrono::nanoseconds(
+                    (updated_at - tolerance - current) / 1000));
+        }
+
+        return duration_t{ 0 };
+
+    } /* consume */
+
+    /*---------------------------------------------------------------------- */
+
+    void token_bucket::reset()
+    {
+        _started_at = monotonic_clock::now();
+        _next_at = 0;
+
+    } /* reset */
+
+    /*---------------------------------------------------------------------- */
+
+    int64_t token_bucket::now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            monotonic_clock::now() - _started_at).count() * 1000;
+
+    } /* now */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae::model */
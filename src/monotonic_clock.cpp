@@ -0,0 +1,158 @@
+/*
+ * Hyenae NG
+ *   Advanced Network Packet Generator (NextGen)
+ *
+ * Copyright (C) 2020 Robin Richter
+ *
+ *   Contact  : hyenae.tool@googlemail.com
+ *   Homepage : https://github.com/r-richter/hyenae-ng
+ *
+ * This file is part of Hyenae NG.
+ *
+ * Hyenae NG is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Hyenae NG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hyenae NG.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../include/monotonic_clock.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define HAVE_TSC
+    #include <cpuid.h>
+    #include <x86intrin.h>
+#endif
+
+namespace hyenae
+{
+    /*---------------------------------------------------------------------- */
+
+    duration_t monotonic_clock::now()
+    {
+        return std::chrono::duration_cast<duration_t>(
+            std::chrono::nanoseconds{ now_ns() });
+
+    } /* now */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t monotonic_clock::since_epoch()
+    {
+        // Wall clock time as of the calibration, advanced by the
+        // monotonic clock, so that it never jumps during a run.
+
+        return std::chrono::duration_cast<duration_t>(
+            std::chrono::nanoseconds{
+                now_ns() + get_calibration().epoch_offset_ns });
+
+    } /* since_epoch */
+
+    /*---------------------------------------------------------------------- */
+
+    bool monotonic_clock::is_tsc_based()
+    {
+        return get_calibration().tsc_based;
+
+    } /* is_tsc_based */
+
+    /*---------------------------------------------------------------------- */
+
+    int64_t monotonic_clock::now_ns()
+    {
+        const calibration& calibration = get_calibration();
+
+#ifdef HAVE_TSC
+        if (calibration.tsc_based)
+        {
+            return calibration.base_ns + (int64_t)
+                ((double)(__rdtsc() - calibration.base_ticks) *
+                    calibration.ns_per_tick);
+        }
+#endif
+        return steady_ns();
+
+    } /* now_ns */
+
+    /*---------------------------------------------------------------------- */
+
+    int64_t monotonic_clock::steady_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    } /* steady_ns */
+
+    /*---------------------------------------------------------------------- */
+
+    const monotonic_clock::calibration& monotonic_clock::get_calibration()
+    {
+        static const calibration calibration = calibrate();
+
+        return calibration;
+
+    } /* get_calibration */
+
+    /*---------------------------------------------------------------------- */
+
+    monotonic_clock::calibration monotonic_clock::calibrate()
+    {
+        calibration result = {};
+
+        result.tsc_based = false;
+        result.base_ns = steady_ns();
+
+#ifdef HAVE_TSC
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        uint64_t start_ticks = 0;
+        int64_t start_ns = 0;
+
+        // The TSC is only usable as a clock if it is invariant, i.e.
+        // ticks at a constant rate regardless of power states.
+
+        if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) &&
+            (edx & (1 << 8)))
+        {
+            start_ticks = __rdtsc();
+            start_ns = steady_ns();
+
+            do
+            {
+                result.base_ticks = __rdtsc();
+                result.base_ns = steady_ns();
+            }
+            while (result.base_ns - start_ns < CALIBRATION_NS);
+
+            if (result.base_ticks > start_ticks)
+            {
+                result.ns_per_tick =
+                    (double)(result.base_ns - start_ns) /
+                    (double)(result.base_ticks - start_ticks);
+
+                result.tsc_based = true;
+            }
+        }
+#endif
+        result.epoch_offset_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count() -
+            result.base_ns;
+
+        return result;
+
+    } /* calibrate */
+
+    /*---------------------------------------------------------------------- */
+
+} /* hyenae */
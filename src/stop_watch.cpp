@@ -40,23 +40,28 @@ namespace hyenae
 
     duration_t stop_watch::get_time_passed() const
     {
-        duration_t now = duration_t{ 0 };
+        return get_time_passed(monotonic_clock::now());
 
-        if (_started_at != duration_t{ 0 })
+    } /* get_time_passed */
+
+    /*---------------------------------------------------------------------- */
+
+    duration_t stop_watch::get_time_passed(duration_t now) const
+    {
+        // Callers that need several watches at once can
+        // pass in a single reading of the clock for all.
+
+        if (!_started)
+        {
+            return duration_t{ 0 };
+        }
+
+        if (_stopped)
         {
-            if (_stopped_at != duration_t{ 0 })
-            {
-                now = _stopped_at;
-            }
-            else
-            {
-                now = clock_t::now().time_since_epoch();
-            }
-
-            return now - _started_at;
+            now = _stopped_at;
         }
-        
-        return duration_t{ 0 };
+
+        return now - _started_at;
 
     } /* get_time_passed */
 
@@ -64,8 +69,17 @@ namespace hyenae
 
     void stop_watch::start()
     {
-        _started_at = clock_t::now().time_since_epoch();
-        _stopped_at = duration_t{ 0 };
+        start(monotonic_clock::now());
+
+    } /* start */
+
+    /*---------------------------------------------------------------------- */
+
+    void stop_watch::start(duration_t now)
+    {
+        _started = true;
+        _stopped = false;
+        _started_at = now;
 
     } /* start */
 
@@ -73,9 +87,10 @@ namespace hyenae
 
     void stop_watch::stop()
     {
-        if (_started_at != duration_t{ 0 })
+        if (_started)
         {
-            _stopped_at = clock_t::now().time_since_epoch();
+            _stopped = true;
+            _stopped_at = monotonic_clock::now();
         }
 
     } /* stop */
@@ -84,6 +99,8 @@ namespace hyenae
 
     void stop_watch::reset()
     {
+        _started = false;
+        _stopped = false;
         _started_at = duration_t{ 0 };
         _stopped_at = duration_t{ 0 };
 